@@ -1085,6 +1085,7 @@ namespace rs2
                 glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
                 break;
             case RS2_FORMAT_Y8:
+            case RS2_FORMAT_NV12: case RS2_FORMAT_I420: // Show the luminance plane only
                 glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
                 break;
             case RS2_FORMAT_MOTION_XYZ32F:
@@ -97,6 +97,16 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 */
 int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error);
 
+/**
+* retrieve all the metadata attributes of a frame in a single pass
+* \param[in] frame       handle returned from a callback
+* \param[out] values     caller-provided array of count values, indexed by rs2_frame_metadata_value. Unsupported attributes are set to 0
+* \param[out] supported  caller-provided array of count flags, set to non-zero where the frame supports the attribute
+* \param[in] count       number of entries in both arrays, usually RS2_FRAME_METADATA_COUNT. Attributes at or beyond count are not reported
+* \return                number of supported attributes written
+*/
+int rs2_get_frame_metadata_all(const rs2_frame* frame, rs2_metadata_type* values, int* supported, int count, rs2_error** error);
+
 /**
 * retrieve timestamp domain from frame handle. timestamps can only be comparable if they are in common domain
 * (for example, depth timestamp might come from system time while color timestamp might come from the device)
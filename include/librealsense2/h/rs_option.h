@@ -62,6 +62,13 @@ typedef enum rs2_option
     RS2_OPTION_FILTER_SMOOTH_DELTA                        , /**< 2D-filter range/validity threshold*/
     RS2_OPTION_HOLES_FILL                                 , /**< Enhance depth data post-processing with holes filling where appropriate*/
     RS2_OPTION_STEREO_BASELINE                            , /**< The distance in mm between the first and the second imagers in stereo-based depth cameras*/
+    RS2_OPTION_ZERO_COPY                                  , /**< Hand out frames of pass-through formats in the capture buffers instead of copying them. Off by default on D400 depth sensors */
+    RS2_OPTION_CAPTURE_BUFFERS                            , /**< Number of buffers the backend captures frames into */
+    RS2_OPTION_CAPTURE_MEMORY                             , /**< Type of memory the backend captures frames into */
+    RS2_OPTION_PARALLEL_UNPACK                            , /**< Unpack large frames in row bands on a thread pool shared by all sensors */
+    RS2_OPTION_UNPACK_QUEUE_SIZE                          , /**< Frames queued between capture and unpacking on a dedicated thread, 0 to unpack on the capture thread */
+    RS2_OPTION_UNPACK_QUEUE_POLICY                        , /**< What happens to a frame that arrives while the unpack queue is full */
+    RS2_OPTION_MAX_DOWNSCALE                              , /**< Largest factor a resolution the sensor also captures natively may be downscaled by from a larger capture, 1 to capture it natively */
     RS2_OPTION_COUNT                                        /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_option;
 const char* rs2_option_to_string(rs2_option option);
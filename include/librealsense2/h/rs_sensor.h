@@ -71,6 +71,8 @@ typedef enum rs2_format
     RS2_FORMAT_GPIO_RAW        , /**< Raw data from the external sensors hooked to one of the GPIO's */
     RS2_FORMAT_6DOF            , /**< Pose data packed as floats array, containing translation vector, rotation quaternion and prediction velocities and accelerations vectors */
     RS2_FORMAT_DISPARITY32     , /**< 32-bit float-point disparity values. Depth->Disparity conversion : Disparity = Baseline*FocalLength/Depth */
+    RS2_FORMAT_NV12            , /**< 8-bit luminance plane followed by a half-resolution plane of interleaved 8-bit U and V samples (YUV 4:2:0) */
+    RS2_FORMAT_I420            , /**< 8-bit luminance plane followed by half-resolution 8-bit U and V planes (YUV 4:2:0) */
     RS2_FORMAT_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_format;
 const char* rs2_format_to_string(rs2_format format);
@@ -255,6 +257,56 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 */
 void rs2_set_notifications_callback_cpp(const rs2_sensor* sensor, rs2_notifications_callback* callback, rs2_error** error);
 
+/**
+* set custom memory allocator for the frame buffers of specified sensor
+* frame pixels will be written directly into memory returned by the allocator, which must stay valid until it is handed back through deallocate
+* both functions may be invoked from any thread, including the library internal threads and the threads releasing frames
+* returned buffers are not cleared by the library and should be aligned to 64 bytes to benefit from vectorized pixel unpacking
+* the allocator takes effect on the next call to rs2_open and cannot be replaced while the sensor is open
+* \param[in] sensor      RealSense sensor
+* \param[in] allocate    function pointer returning a buffer of at least the requested number of bytes, or null on failure
+* \param[in] deallocate  function pointer receiving buffers previously returned by allocate, together with their size
+* \param[in] user        auxiliary data the user wishes to receive together with every allocation request
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void* user, rs2_error** error);
+
+/**
+* set custom memory allocator for the frame buffers of specified sensor
+* \param[in] sensor     RealSense sensor
+* \param[in] allocator  allocator object created from c++ application. ownership over the allocator object is moved into the sensor, and it is released once the last frame buffer it provided is freed
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error);
+
+/**
+* retrieve frame allocation and lifetime counters of specified sensor
+* frequent drops together with a peak_in_flight close to RS2_OPTION_FRAMES_QUEUE_SIZE indicate the queue size is too small for the way frames are held
+* \param[in] sensor     RealSense sensor
+* \param[out] stats     receives the counters
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_sensor_frame_stats(const rs2_sensor* sensor, rs2_frame_stats* stats, rs2_error** error);
+
+/**
+* retrieve the distribution of a latency of one of the streams of specified sensor
+* the percentiles are meant for alarming on latency regressions, e.g. a p99 of RS2_LATENCY_ARRIVAL_TO_CALLBACK approaching the frame interval
+* \param[in] sensor     RealSense sensor
+* \param[in] stream     stream type
+* \param[in] index      stream index
+* \param[in] type       latency to retrieve
+* \param[out] stats     receives the distribution, with a count of zero if the stream delivered no frame to a callback
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_sensor_latency_stats(const rs2_sensor* sensor, rs2_stream stream, int index, rs2_latency_type type, rs2_latency_stats* stats, rs2_error** error);
+
+/**
+* clear the latency distributions of all the streams of specified sensor
+* \param[in] sensor     RealSense sensor
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_reset_sensor_latency_stats(const rs2_sensor* sensor, rs2_error** error);
+
 /**
 * retrieve description from notification handle
 * \param[in] notification      handle returned from a callback
@@ -9,6 +9,8 @@
 #ifndef LIBREALSENSE_RS2_TYPES_H
 #define LIBREALSENSE_RS2_TYPES_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -77,6 +79,41 @@ typedef struct rs2_motion_device_intrinsic
     float bias_variances[3];   /**< Variance of bias for X, Y, and Z axis */
 } rs2_motion_device_intrinsic;
 
+/** \brief Frame allocation and lifetime counters of a sensor, accumulated since the sensor was created */
+typedef struct rs2_frame_stats
+{
+    unsigned long long allocations;     /**< Number of frames allocated */
+    unsigned long long buffer_reuses;   /**< Number of frame buffers recycled from previously released frames instead of newly allocated */
+    unsigned long long bytes_allocated; /**< Total size of newly allocated frame buffers, in bytes */
+    unsigned long long drops;           /**< Number of frames dropped because RS2_OPTION_FRAMES_QUEUE_SIZE frames were already held */
+    unsigned int       in_flight;       /**< Number of frames currently held, by the user or by the library */
+    unsigned int       peak_in_flight;  /**< Largest number of frames held at once */
+    double             mean_hold_time;  /**< Mean time between the publication of a frame and its release, in milliseconds */
+} rs2_frame_stats;
+
+/** \brief Latencies measured along the frame path of every stream */
+typedef enum rs2_latency_type
+{
+    RS2_LATENCY_SENSOR_TO_ARRIVAL,    /**< From the frame timestamp to the arrival of the frame at the host. Camera clocks are not synchronized with the host, so for hardware clock timestamps this is relative to the fastest frame measured */
+    RS2_LATENCY_ARRIVAL_TO_CALLBACK,  /**< From the arrival of the frame at the host to the invocation of the user callback */
+    RS2_LATENCY_CALLBACK_DURATION,    /**< Time spent in the user callback */
+    RS2_LATENCY_TYPE_COUNT            /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
+} rs2_latency_type;
+const char* rs2_latency_type_to_string(rs2_latency_type type);
+
+/** \brief Distribution of a latency of a stream, accumulated since the sensor was created or its latency statistics were last reset. All times are in milliseconds, percentiles are accurate to about 3% */
+typedef struct rs2_latency_stats
+{
+    unsigned long long count;   /**< Number of frames measured */
+    double             min;     /**< Smallest latency measured */
+    double             mean;    /**< Mean latency */
+    double             max;     /**< Largest latency measured */
+    double             p50;     /**< Median latency */
+    double             p90;     /**< 90th percentile */
+    double             p99;     /**< 99th percentile */
+    double             p999;    /**< 99.9th percentile */
+} rs2_latency_stats;
+
 /** \brief Severity of the librealsense logger */
 typedef enum rs2_log_severity {
     RS2_LOG_SEVERITY_DEBUG, /**< Detailed information about ordinary operations */
@@ -171,10 +208,16 @@ typedef struct rs2_options rs2_options;
 typedef struct rs2_devices_changed_callback rs2_devices_changed_callback;
 typedef struct rs2_notification rs2_notification;
 typedef struct rs2_notifications_callback rs2_notifications_callback;
+typedef struct rs2_frame_allocator rs2_frame_allocator;
+typedef struct rs2_task rs2_task;
+typedef struct rs2_executor_callback rs2_executor_callback;
 typedef void (*rs2_notification_callback_ptr)(rs2_notification*, void*);
 typedef void (*rs2_devices_changed_callback_ptr)(rs2_device_list*, rs2_device_list*, void*);
 typedef void (*rs2_frame_callback_ptr)(rs2_frame*, void*);
 typedef void (*rs2_frame_processor_callback_ptr)(rs2_frame**, int, rs2_source*, void*);
+typedef void* (*rs2_frame_allocate_ptr)(size_t, void*);
+typedef void (*rs2_frame_deallocate_ptr)(void*, size_t, void*);
+typedef void (*rs2_executor_callback_ptr)(rs2_task*, void*);
 
 typedef double      rs2_time_t;     /**< Timestamp format. units are milliseconds */
 typedef long long   rs2_metadata_type; /**< Metadata attribute type is defined as 64 bit signed integer*/
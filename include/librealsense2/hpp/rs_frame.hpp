@@ -318,6 +318,20 @@ namespace rs2
             return r != 0;
         }
 
+        /** retrieve all the metadata attributes of the frame at once
+        * \param[out] values     array of count values, indexed by rs2_frame_metadata_value
+        * \param[out] supported  array of count flags, non-zero where the attribute is available
+        * \param[in] count       number of entries in both arrays
+        * \return                the number of supported attributes
+        */
+        int get_frame_metadata_all(rs2_metadata_type* values, int* supported, int count = ::RS2_FRAME_METADATA_COUNT) const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_frame_metadata_all(frame_ref, values, supported, count, &e);
+            error::handle(e);
+            return r;
+        }
+
         /**
         * retrieve frame number (from frame handle)
         * \return               the frame number of the frame, in milliseconds since the device was started
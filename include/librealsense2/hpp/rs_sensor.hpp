@@ -111,6 +111,27 @@ namespace rs2
         void release() override { delete this; }
     };
 
+    template<class A, class D>
+    class frame_allocator : public rs2_frame_allocator
+    {
+        A allocate_function;
+        D deallocate_function;
+    public:
+        frame_allocator(A allocate, D deallocate) : allocate_function(allocate), deallocate_function(deallocate) {}
+
+        void* allocate(size_t size) override
+        {
+            return allocate_function(size);
+        }
+
+        void deallocate(void* buffer, size_t size) override
+        {
+            deallocate_function(buffer, size);
+        }
+
+        void release() override { delete this; }
+    };
+
     class options
     {
     public:
@@ -341,6 +362,59 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * register custom memory allocator for the frame buffers of this sensor, takes effect on the next call to open
+        * \param[in] allocate     any callable object accepting the buffer size in bytes and returning void*
+        * \param[in] deallocate   any callable object accepting the buffer and its size in bytes
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(),
+                new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+
+        /**
+        * retrieve frame allocation and lifetime counters of this sensor
+        * \return   counters accumulated since the sensor was created
+        */
+        rs2_frame_stats get_frame_stats() const
+        {
+            rs2_error* e = nullptr;
+            rs2_frame_stats stats;
+            rs2_get_sensor_frame_stats(_sensor.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
+        /**
+        * retrieve the distribution of a latency of one of the streams of this sensor
+        * \param[in] stream    stream type
+        * \param[in] index     stream index
+        * \param[in] type      latency to retrieve
+        * \return              distribution accumulated since the sensor was created or reset_latency_stats was called
+        */
+        rs2_latency_stats get_latency_stats(rs2_stream stream, int index, rs2_latency_type type) const
+        {
+            rs2_error* e = nullptr;
+            rs2_latency_stats stats;
+            rs2_get_sensor_latency_stats(_sensor.get(), stream, index, type, &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
+        /**
+        * clear the latency distributions of all the streams of this sensor
+        */
+        void reset_latency_stats() const
+        {
+            rs2_error* e = nullptr;
+            rs2_reset_sensor_latency_stats(_sensor.get(), &e);
+            error::handle(e);
+        }
+
 
         /**
         * check if physical sensor is supported
@@ -45,6 +45,21 @@ struct rs2_notifications_callback
     virtual                                 ~rs2_notifications_callback() {}
 };
 
+struct rs2_frame_allocator
+{
+    virtual void*                           allocate(size_t size) = 0;
+    virtual void                            deallocate(void* buffer, size_t size) = 0;
+    virtual void                            release() = 0;
+    virtual                                 ~rs2_frame_allocator() {}
+};
+
+struct rs2_executor_callback
+{
+    virtual void                            on_task(rs2_task * task) = 0;
+    virtual void                            release() = 0;
+    virtual                                 ~rs2_executor_callback() {}
+};
+
 struct rs2_log_callback
 {
     virtual void                            on_event(rs2_log_severity severity, const char * message) = 0;
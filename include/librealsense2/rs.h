@@ -71,6 +71,60 @@ void rs2_log_to_console(rs2_log_severity min_severity, rs2_error ** error);
 
 void rs2_log_to_file(rs2_log_severity min_severity, const char * file_path, rs2_error ** error);
 
+/**
+ * Start or stop recording the trace points of the frame path (backend dequeue, unpacking, publishing, syncing,
+ * processing blocks and user callbacks). Each thread keeps its most recent events in a fixed-size ring buffer
+ * \param[in] enable  non-zero to start recording, zero to stop
+ * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_enable_frame_trace(int enable, rs2_error ** error);
+
+/**
+ * Write the recorded trace events to a JSON file in Chrome trace event format, viewable in chrome://tracing or Perfetto
+ * \param[in] file_path  path of the file to write
+ * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_dump_frame_trace(const char * file_path, rs2_error ** error);
+
+/**
+ * Set the size and CPU affinity of the thread pool that runs the background work of the library (recording, playback,
+ * notifications, auto-exposure and polling), instead of a thread per object. Objects created afterwards use the new pool
+ * \param[in] threads        number of threads, 0 for one per CPU core
+ * \param[in] affinity_mask  CPUs the threads may run on, bit i standing for CPU i, 0 for any
+ * \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_configure_executor(int threads, unsigned long long affinity_mask, rs2_error** error);
+
+/**
+ * Run the background work of the library on an executor of the application: on_task receives every task, which the application
+ * then runs once with rs2_run_task, on a thread other than the one calling on_task. Tasks may block for a while, such as to pace playback.
+ * Objects created afterwards use the executor, which has to keep running tasks until they are deleted
+ * \param[in] on_task  called with every task, null to restore the thread pool of the library
+ * \param[in] user     passed to on_task
+ * \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_set_executor(rs2_executor_callback_ptr on_task, void* user, rs2_error** error);
+
+/**
+ * Run the background work of the library on an executor of the application, see rs2_set_executor
+ * \param[in] callback  receives every task, null to restore the thread pool of the library
+ * \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_set_executor_cpp(rs2_executor_callback* callback, rs2_error** error);
+
+/**
+ * Run a task handed to the executor of the application, and delete it
+ * \param[in] task    task received by the executor
+ * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_run_task(rs2_task* task, rs2_error** error);
+
+/**
+ * Delete a task handed to the executor of the application without running it, such as when the application exits
+ * \param[in] task    task received by the executor
+ */
+void rs2_delete_task(rs2_task* task);
+
 /**
  * Add custom message into librealsense log
  * \param[in] severity  The log level for the message to be written under
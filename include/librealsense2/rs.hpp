@@ -30,6 +30,110 @@ namespace rs2
         error::handle(e);
     }
 
+    inline void enable_frame_trace(bool enable = true)
+    {
+        rs2_error* e = nullptr;
+        rs2_enable_frame_trace(enable ? 1 : 0, &e);
+        error::handle(e);
+    }
+
+    inline void dump_frame_trace(const char * file_path)
+    {
+        rs2_error* e = nullptr;
+        rs2_dump_frame_trace(file_path, &e);
+        error::handle(e);
+    }
+
+    /**
+    * Set the size and CPU affinity of the thread pool that runs the background work of the library
+    * \param[in] threads        number of threads, 0 for one per CPU core
+    * \param[in] affinity_mask  CPUs the threads may run on, bit i standing for CPU i, 0 for any
+    */
+    inline void configure_executor(int threads, unsigned long long affinity_mask = 0)
+    {
+        rs2_error* e = nullptr;
+        rs2_configure_executor(threads, affinity_mask, &e);
+        error::handle(e);
+    }
+
+    /**
+    * A unit of background work of the library, handed to the executor of the application
+    */
+    class task
+    {
+    public:
+        explicit task(rs2_task* t) : _task(t) {}
+        task(task&& other) : _task(other._task) { other._task = nullptr; }
+        task& operator=(task&& other)
+        {
+            if (this != &other)
+            {
+                if (_task) rs2_delete_task(_task);
+                _task = other._task;
+                other._task = nullptr;
+            }
+            return *this;
+        }
+        ~task() { if (_task) rs2_delete_task(_task); }
+
+        /**
+        * Run the task, which can be done once
+        */
+        void run()
+        {
+            auto t = _task;
+            _task = nullptr;
+            rs2_error* e = nullptr;
+            rs2_run_task(t, &e);
+            error::handle(e);
+        }
+
+        explicit operator bool() const { return _task != nullptr; }
+
+    private:
+        task(const task&) = delete;
+        task& operator=(const task&) = delete;
+
+        rs2_task* _task;
+    };
+
+    template<class T>
+    class executor_callback : public rs2_executor_callback
+    {
+        T on_task_function;
+    public:
+        explicit executor_callback(T on_task) : on_task_function(on_task) {}
+
+        void on_task(rs2_task* t) override
+        {
+            on_task_function(task{ t });
+        }
+
+        void release() override { delete this; }
+    };
+
+    /**
+    * Run the background work of the library on an executor of the application
+    * \param[in] on_task  called with every task, which it has to run once, on another thread
+    */
+    template<class T>
+    void set_executor(T on_task)
+    {
+        rs2_error* e = nullptr;
+        rs2_set_executor_cpp(new executor_callback<T>(std::move(on_task)), &e);
+        error::handle(e);
+    }
+
+    /**
+    * Go back to running the background work of the library on its own thread pool
+    */
+    inline void reset_executor()
+    {
+        rs2_error* e = nullptr;
+        rs2_set_executor_cpp(nullptr, &e);
+        error::handle(e);
+    }
+
     inline void log(rs2_log_severity severity, const char* message)
     {
         rs2_error* e = nullptr;
@@ -43,6 +147,7 @@ inline std::ostream & operator << (std::ostream & o, rs2_format format) { return
 inline std::ostream & operator << (std::ostream & o, rs2_distortion distortion) { return o << rs2_distortion_to_string(distortion); }
 inline std::ostream & operator << (std::ostream & o, rs2_option option) { return o << rs2_option_to_string(option); }
 inline std::ostream & operator << (std::ostream & o, rs2_log_severity severity) { return o << rs2_log_severity_to_string(severity); }
+inline std::ostream & operator << (std::ostream & o, rs2_latency_type type) { return o << rs2_latency_type_to_string(type); }
 inline std::ostream & operator << (std::ostream & o, rs2_camera_info camera_info) { return o << rs2_camera_info_to_string(camera_info); }
 inline std::ostream & operator << (std::ostream & o, rs2_frame_metadata_value metadata) { return o << rs2_frame_metadata_to_string(metadata); }
 inline std::ostream & operator << (std::ostream & o, rs2_timestamp_domain domain) { return o << rs2_timestamp_domain_to_string(domain); }
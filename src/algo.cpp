@@ -40,101 +40,87 @@ void auto_exposure_state::set_auto_exposure_antiflicker_rate(unsigned value)
 auto_exposure_mechanism::auto_exposure_mechanism(option& gain_option, option& exposure_option, const auto_exposure_state& auto_exposure_state)
     : _auto_exposure_algo(auto_exposure_state),
       _keep_alive(true), _frames_counter(0),
-      _skip_frames(auto_exposure_state.skip_frames), _data_queue(queue_size),
-      _gain_option(gain_option), _exposure_option(exposure_option)
+      _skip_frames(auto_exposure_state.skip_frames),
+      _gain_option(gain_option), _exposure_option(exposure_option), _dispatcher(queue_size)
 {
-    _exposure_thread = std::make_shared<std::thread>(
-                [this]()
+    _dispatcher.start();
+}
+
+void auto_exposure_mechanism::analyze_frame(frame_holder frame)
+{
+    try
     {
-        while (_keep_alive)
+        double values[2] = {};
+
         {
-            std::unique_lock<std::mutex> lk(_queue_mtx);
-            _cv.wait(lk, [&] {return (_data_queue.size() || !_keep_alive); });
+            // Without metadata the options are read from the device, a control transfer the strand waits for
+            blocking_region blocking;
+            values[0] = frame->supports_frame_metadata(RS2_FRAME_METADATA_ACTUAL_EXPOSURE) ?
+                        static_cast<double>(frame->get_frame_metadata(RS2_FRAME_METADATA_ACTUAL_EXPOSURE)) : _exposure_option.query();
+            values[1] = frame->supports_frame_metadata(RS2_FRAME_METADATA_GAIN_LEVEL) ?
+                        static_cast<double>(frame->get_frame_metadata(RS2_FRAME_METADATA_GAIN_LEVEL)) : _gain_option.query();
+        }
 
-            if (!_keep_alive)
-                return;
+        values[0] /= 1000.; // Fisheye exposure value by extension control-
+                            // is in units of MicroSeconds, from FW version 5.6.3.0
 
-            frame_and_callback frame_callback;
-            auto frame_sts = _data_queue.dequeue(&frame_callback);
+        auto exposure_value = static_cast<float>(values[0]);
+        auto gain_value = static_cast<float>(2. + (values[1] - 15.) / 8.);
 
-            lk.unlock();
+        bool modify_exposure = false, modify_gain = false;
+        {
+            std::lock_guard<std::mutex> lk(_algo_mtx);
+            if (_auto_exposure_algo.analyze_image(frame))
+                _auto_exposure_algo.modify_exposure(exposure_value, modify_exposure, gain_value, modify_gain);
+        }
 
-            if (!frame_sts)
-            {
-                LOG_ERROR("After waiting on data_queue signalled there are no frames on queue");
-                continue;
-            }
-            try
-            {
-                auto frame = std::move(frame_callback.f_holder);
-
-                double values[2] = {};
-
-                values[0] = frame->supports_frame_metadata(RS2_FRAME_METADATA_ACTUAL_EXPOSURE) ?
-                            static_cast<double>(frame->get_frame_metadata(RS2_FRAME_METADATA_ACTUAL_EXPOSURE)) : _exposure_option.query();
-                values[1] = frame->supports_frame_metadata(RS2_FRAME_METADATA_GAIN_LEVEL) ?
-                            static_cast<double>(frame->get_frame_metadata(RS2_FRAME_METADATA_GAIN_LEVEL)) : _gain_option.query();
-
-                values[0] /= 1000.; // Fisheye exposure value by extension control-
-                                    // is in units of MicroSeconds, from FW version 5.6.3.0
-
-                auto exposure_value = static_cast<float>(values[0]);
-                auto gain_value = static_cast<float>(2. + (values[1] - 15.) / 8.);
-
-                bool sts = _auto_exposure_algo.analyze_image(frame);
-                if (sts)
-                {
-                    bool modify_exposure, modify_gain;
-                    _auto_exposure_algo.modify_exposure(exposure_value, modify_exposure, gain_value, modify_gain);
-
-                    if (modify_exposure)
-                    {
-                        auto value = exposure_value * 1000.f;
-                        if (value < 1)
-                            value = 1;
-
-                        _exposure_option.set(value);
-                    }
-
-                    if (modify_gain)
-                    {
-                        auto value =  (gain_value - 2.f) * 8.f + 15.f;
-                        _gain_option.set(value);
-                    }
-                }
-            }
-            catch (const std::exception& ex)
+        if (modify_exposure || modify_gain)
+        {
+            // Setting the options is a control transfer to the device
+            blocking_region blocking;
+
+            if (modify_exposure)
             {
-                LOG_ERROR("Error during Auto-Exposure loop: " << ex.what());
+                auto value = exposure_value * 1000.f;
+                if (value < 1)
+                    value = 1;
+
+                _exposure_option.set(value);
             }
-            catch (...)
+
+            if (modify_gain)
             {
-                LOG_ERROR("Unknown error during Auto-Exposure loop!");
+                auto value =  (gain_value - 2.f) * 8.f + 15.f;
+                _gain_option.set(value);
             }
         }
-    });
+    }
+    catch (const std::exception& ex)
+    {
+        LOG_ERROR("Error during Auto-Exposure loop: " << ex.what());
+    }
+    catch (...)
+    {
+        LOG_ERROR("Unknown error during Auto-Exposure loop!");
+    }
 }
 
 auto_exposure_mechanism::~auto_exposure_mechanism()
 {
-    {
-        std::lock_guard<std::mutex> lk(_queue_mtx);
-        _keep_alive = false;
-    }
-    _cv.notify_one();
-    _exposure_thread->join();
+    _keep_alive = false;
+    _dispatcher.stop();
 }
 
 void auto_exposure_mechanism::update_auto_exposure_state(const auto_exposure_state& auto_exposure_state)
 {
-    std::lock_guard<std::mutex> lk(_queue_mtx);
+    std::lock_guard<std::mutex> lk(_algo_mtx);
     _skip_frames = auto_exposure_state.skip_frames;
     _auto_exposure_algo.update_options(auto_exposure_state);
 }
 
 void auto_exposure_mechanism::update_auto_exposure_roi(const region_of_interest& roi)
 {
-    std::lock_guard<std::mutex> lk(_queue_mtx);
+    std::lock_guard<std::mutex> lk(_algo_mtx);
     _auto_exposure_algo.update_roi(roi);
 }
 
@@ -148,11 +134,8 @@ void auto_exposure_mechanism::add_frame(frame_holder frame, callback_invocation_
 
     _frames_counter = 0;
 
-    {
-        std::lock_guard<std::mutex> lk(_queue_mtx);
-        _data_queue.enqueue({std::move(frame), std::move(callback)});
-    }
-    _cv.notify_one();
+    // The dispatcher keeps the newest queue_size frames
+    _dispatcher.invoke(analyze_task{ this, { std::move(frame), std::move(callback) } });
 }
 
 auto_exposure_algorithm::auto_exposure_algorithm(const auto_exposure_state& auto_exposure_state)
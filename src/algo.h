@@ -122,19 +122,26 @@ namespace librealsense
         };
 
     private:
-        bool try_pop_front_data(frame_and_callback* data);
+        void analyze_frame(frame_holder frame);
+
+        // Owns the frame, and the callback invocation it was delivered in, until analyzed
+        struct analyze_task
+        {
+            auto_exposure_mechanism* owner;
+            frame_and_callback data;
+
+            void operator()(dispatcher::cancellable_timer t) { owner->analyze_frame(std::move(data.f_holder)); }
+        };
 
         static const int                          queue_size = 2;
         option&                                   _gain_option;
         option&                                   _exposure_option;
         auto_exposure_algorithm                   _auto_exposure_algo;
-        std::shared_ptr<std::thread>              _exposure_thread;
-        std::condition_variable                   _cv;
         std::atomic<bool>                         _keep_alive;
-        single_consumer_queue<frame_and_callback> _data_queue;
-        std::mutex                                _queue_mtx;
+        std::mutex                                _algo_mtx;          // between the analysis and updates of the algorithm's settings
         std::atomic<unsigned>                     _frames_counter;
         std::atomic<unsigned>                     _skip_frames;
+        dispatcher                                _dispatcher;
     };
 
 }
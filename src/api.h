@@ -38,6 +38,11 @@ struct rs2_device
     std::shared_ptr<librealsense::device_interface> device;
 };
 
+struct rs2_task
+{
+    executor::task task;
+};
+
 namespace librealsense
 {
     // Facilities for streaming function arguments
@@ -107,60 +107,225 @@ namespace librealsense
         return ijs;
     }
 
+    // Metadata blocks are recycled through a lock-free heap shared by all frames
+    // The heap is intentionally never destroyed, as frames may outlive static destruction
+    static small_heap<frame_metadata_blob::block>& metadata_heap()
+    {
+        static auto heap = new small_heap<frame_metadata_blob::block>(1024);
+        return *heap;
+    }
+
+    static const uint8_t* empty_metadata()
+    {
+        static const uint8_t empty[MAX_META_DATA_SIZE] = {};
+        return empty;
+    }
+
+    static frame_metadata_blob::block* allocate_metadata_block()
+    {
+        auto b = metadata_heap().allocate();
+        if (!b) b = new frame_metadata_blob::block();
+        b->refs = 1;
+        return b;
+    }
+
+    // Lock-free pool of recycled frame buffers, bucketed by buffer size
+    // Every size class owns a fixed array of slots that hold the buffers in place; returning a buffer claims
+    // an empty slot with a single compare-and-swap and reusing one claims a full slot the same way, so the
+    // capture thread and the user threads releasing frames never wait on each other, nor allocate
+    template<class Buffer>
+    class frame_buffer_pool
+    {
+    public:
+        static const int MAX_SIZE_CLASSES = 8;
+        static const int MAX_BUFFERS_PER_CLASS = 16;
+
+        struct statistics
+        {
+            unsigned long long hits;
+            unsigned long long misses;
+            unsigned long long evictions;
+        };
+
+        // Keeps up to max_buffers_per_class buffers of each size, for up to max_age_ms milliseconds
+        explicit frame_buffer_pool(uint32_t max_buffers_per_class = MAX_BUFFERS_PER_CLASS, rs2_time_t max_age_ms = 1000)
+            : _max_buffers(std::min<uint32_t>(max_buffers_per_class, MAX_BUFFERS_PER_CLASS)), _max_age(max_age_ms),
+              _hits(0), _misses(0), _evictions(0)
+        {
+            for (auto&& c : _classes)
+            {
+                c.size = 0;
+                for (auto&& s : c.slots) s.state = empty;
+            }
+        }
+
+        ~frame_buffer_pool() { clear(); }
+
+        // Take a buffer of exactly the requested size out of the pool, if one is available
+        bool acquire(size_t size, rs2_time_t now, Buffer& out)
+        {
+            if (auto c = find_class(size, false))
+            {
+                for (auto&& s : c->slots)
+                {
+                    if (s.state.load(std::memory_order_relaxed) != full) continue;
+
+                    auto expected = full;
+                    if (!s.state.compare_exchange_strong(expected, busy, std::memory_order_acquire)) continue;
+
+                    if (now > s.released_at + _max_age)
+                    {
+                        Buffer().swap(s.buffer);
+                        s.state.store(empty, std::memory_order_release);
+                        ++_evictions;
+                        continue;
+                    }
+
+                    out = std::move(s.buffer);
+                    s.state.store(empty, std::memory_order_release);
+                    ++_hits;
+                    return true;
+                }
+            }
+            ++_misses;
+            return false;
+        }
+
+        // Hand a buffer back to the pool. Buffers that do not fit are simply freed
+        void release(Buffer&& buffer, rs2_time_t now)
+        {
+            auto size = buffer.size();
+            if (!size) return;
+
+            if (auto c = find_class(size, true))
+            {
+                for (uint32_t i = 0; i < _max_buffers; i++)
+                {
+                    auto& s = c->slots[i];
+                    auto expected = empty;
+                    if (s.state.compare_exchange_strong(expected, busy, std::memory_order_acquire))
+                    {
+                        s.buffer = std::move(buffer);
+                        s.released_at = now;
+                        s.state.store(full, std::memory_order_release);
+                        return;
+                    }
+                }
+            }
+            ++_evictions;
+        }
+
+        void clear()
+        {
+            for (auto&& c : _classes)
+            {
+                for (auto&& s : c.slots)
+                {
+                    auto expected = full;
+                    if (s.state.compare_exchange_strong(expected, busy, std::memory_order_acquire))
+                    {
+                        Buffer().swap(s.buffer);
+                        s.state.store(empty, std::memory_order_release);
+                    }
+                }
+            }
+        }
+
+        statistics get_statistics() const
+        {
+            return{ _hits.load(), _misses.load(), _evictions.load() };
+        }
+
+    private:
+        enum slot_state { empty, busy, full }; // busy while a thread moves a buffer in or out
+
+        struct slot
+        {
+            std::atomic<slot_state> state;
+            Buffer buffer;
+            rs2_time_t released_at;
+        };
+
+        struct size_class
+        {
+            std::atomic<size_t> size; // zero until the class is claimed by the first buffer of that size
+            slot slots[MAX_BUFFERS_PER_CLASS];
+        };
+
+        size_class* find_class(size_t size, bool claim)
+        {
+            for (auto&& c : _classes)
+            {
+                auto current = c.size.load(std::memory_order_acquire);
+                if (current == size) return &c;
+                if (current == 0)
+                {
+                    if (!claim) return nullptr;
+                    if (c.size.compare_exchange_strong(current, size) || current == size)
+                        return &c;
+                }
+            }
+            return nullptr;
+        }
+
+        size_class _classes[MAX_SIZE_CLASSES];
+        const uint32_t _max_buffers;
+        const rs2_time_t _max_age;
+        std::atomic<unsigned long long> _hits;
+        std::atomic<unsigned long long> _misses;
+        std::atomic<unsigned long long> _evictions;
+    };
+
     // Defines general frames storage model
     template<class T>
-    class frame_archive : public std::enable_shared_from_this<frame_archive<T>>, public archive_interface
+    class frame_archive : public archive_interface
     {
         std::atomic<uint32_t>* max_frame_queue_size;
         std::atomic<uint32_t> published_frames_count;
-        small_heap<T, RS2_USER_QUEUE_SIZE> published_frames;
+        small_heap<T> published_frames;   // as many slots as the queue size at creation, frames beyond that are allocated one by one
 
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
+        frame_buffer_pool<decltype(T::data)> buffer_pool; // return frame buffers here
         std::atomic<bool> recycle_frames;
         int pending_frames = 0;
         std::recursive_mutex mutex;
         std::shared_ptr<platform::time_service> _time_service;
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
+        frame_allocator_ptr _allocator;
+        std::shared_ptr<frame_statistics> _stats;
+
+        // The archive is kept alive by its owner's handle plus one reference per published frame,
+        // so that frames can refer to it by a plain pointer
+        std::atomic<int> lifetime_refs;
 
         std::weak_ptr<sensor_interface> _sensor;
         std::shared_ptr<sensor_interface> get_sensor() const override { return _sensor.lock(); }
         void set_sensor(std::shared_ptr<sensor_interface> s) override { _sensor = s; }
 
+        rs2_time_t now() const
+        {
+            return _time_service ? _time_service->get_time() : 0;
+        }
+
         T alloc_frame(const size_t size, const frame_additional_data& additional_data, bool requires_memory)
         {
             T backbuffer;
-            //const size_t size = modes[stream].get_image_size(stream);
+            ++_stats->allocations;
+            if (requires_memory)
             {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
+                // Attempt to obtain a buffer of the appropriate size from the pool
+                if (buffer_pool.acquire(size, now(), backbuffer.data))
                 {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
-                    {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
-                    }
+                    ++_stats->buffer_reuses;
                 }
-
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
+                else
                 {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
+                    backbuffer.data = frame_data(frame_buffer_allocator<byte>(_allocator));
+                    backbuffer.data.resize(size);
+                    _stats->bytes_allocated += size;
                 }
             }
-
-            if (requires_memory)
-            {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
-            }
             backbuffer.additional_data = additional_data;
             return backbuffer;
         }
@@ -169,7 +334,7 @@ namespace librealsense
         {
             std::unique_lock<std::recursive_mutex> lock(mutex);
 
-            auto published_frame = f.publish(this->shared_from_this());
+            auto published_frame = f.publish(this);
             if (published_frame)
             {
                 published_frame->acquire();
@@ -186,20 +351,21 @@ namespace librealsense
             {
                 auto f = (T*)frame;
                 log_frame_callback_end(f);
-                std::unique_lock<std::recursive_mutex> lock(mutex);
+                _stats->on_release(now() - f->get_publish_time());
 
                 frame->keep();
 
                 if (recycle_frames)
                 {
-                    freelist.push_back(std::move(*f));
+                    buffer_pool.release(std::move(f->data), now());
                 }
-                lock.unlock();
 
                 if (f->is_fixed())
                     published_frames.deallocate(f);
                 else
                     delete f;
+
+                release_ref(); // may destroy the archive, nothing can follow
             }
         }
 
@@ -218,6 +384,7 @@ namespace librealsense
                 && max_frames)
             {
                 LOG_DEBUG("User didn't release frame resource.");
+                ++_stats->drops;
                 return nullptr;
             }
             auto new_frame = (max_frames ? published_frames.allocate() : new T());
@@ -233,6 +400,9 @@ namespace librealsense
                 
             ++published_frames_count;
             *new_frame = std::move(*f);
+            new_frame->set_publish_time(now());
+            _stats->on_publish();
+            add_ref();
 
             return new_frame;
         }
@@ -258,19 +428,35 @@ namespace librealsense
             }
         }
 
-        std::shared_ptr<metadata_parser_map> get_md_parsers() const { return _metadata_parsers; };
+        const metadata_parser_map* get_md_parsers() const { return _metadata_parsers.get(); };
 
         friend class frame;
 
     public:
         explicit frame_archive(std::atomic<uint32_t>* in_max_frame_queue_size,
                              std::shared_ptr<platform::time_service> ts,
-                             std::shared_ptr<metadata_parser_map> parsers)
+                             std::shared_ptr<metadata_parser_map> parsers,
+                             frame_allocator_ptr allocator,
+                             std::shared_ptr<frame_statistics> stats)
             : max_frame_queue_size(in_max_frame_queue_size),
+              published_frames(in_max_frame_queue_size->load()),
               mutex(), recycle_frames(true), _time_service(ts),
-              _metadata_parsers(parsers)
+              _metadata_parsers(parsers), _allocator(std::move(allocator)),
+              _stats(stats ? std::move(stats) : std::make_shared<frame_statistics>())
         {
             published_frames_count = 0;
+            lifetime_refs = 1;
+        }
+
+        void add_ref()
+        {
+            lifetime_refs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void release_ref()
+        {
+            if (lifetime_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete this;
         }
 
         callback_invocation_holder begin_callback()
@@ -303,10 +489,10 @@ namespace librealsense
             // wait until user is done with all the stuff he chose to borrow
             callback_inflight.wait_until_empty();
 
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-                freelist.clear();
-            }
+            buffer_pool.clear();
+            auto pool_stats = buffer_pool.get_statistics();
+            LOG_DEBUG("Frame buffer pool of archive 0x" << std::hex << this << std::dec << ": " << pool_stats.hits << " hits, "
+                << pool_stats.misses << " misses, " << pool_stats.evictions << " evictions");
 
             pending_frames = published_frames.get_size();
             if (pending_frames > 0)
@@ -329,38 +515,224 @@ namespace librealsense
 
     };
 
+    // The handle given to the owner only drops the owner's reference, the last frame to be released
+    // destroys the archive
+    template<class T>
+    std::shared_ptr<archive_interface> make_frame_archive(std::atomic<uint32_t>* in_max_frame_queue_size,
+                                                          std::shared_ptr<platform::time_service> ts,
+                                                          std::shared_ptr<metadata_parser_map> parsers,
+                                                          frame_allocator_ptr allocator,
+                                                          std::shared_ptr<frame_statistics> stats)
+    {
+        return std::shared_ptr<archive_interface>(new frame_archive<T>(in_max_frame_queue_size, ts, parsers, allocator, stats),
+                                                  [](archive_interface* a) { static_cast<frame_archive<T>*>(a)->release_ref(); });
+    }
+
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
                                                     std::atomic<uint32_t>* in_max_frame_queue_size,
                                                     std::shared_ptr<platform::time_service> ts,
-                                                    std::shared_ptr<metadata_parser_map> parsers)
+                                                    std::shared_ptr<metadata_parser_map> parsers,
+                                                    frame_allocator_ptr allocator,
+                                                    std::shared_ptr<frame_statistics> stats)
     {
         switch(type)
         {
         case RS2_EXTENSION_VIDEO_FRAME :
-            return std::make_shared<frame_archive<video_frame>>(in_max_frame_queue_size, ts, parsers);
+            return make_frame_archive<video_frame>(in_max_frame_queue_size, ts, parsers, allocator, stats);
 
         case RS2_EXTENSION_COMPOSITE_FRAME :
-            return std::make_shared<frame_archive<composite_frame>>(in_max_frame_queue_size, ts, parsers);
+            return make_frame_archive<composite_frame>(in_max_frame_queue_size, ts, parsers, allocator, stats);
 
         case RS2_EXTENSION_MOTION_FRAME:
-            return std::make_shared<frame_archive<motion_frame>>(in_max_frame_queue_size, ts, parsers);
+            return make_frame_archive<motion_frame>(in_max_frame_queue_size, ts, parsers, allocator, stats);
 
         case RS2_EXTENSION_POINTS:
-            return std::make_shared<frame_archive<points>>(in_max_frame_queue_size, ts, parsers);
+            return make_frame_archive<points>(in_max_frame_queue_size, ts, parsers, allocator, stats);
 
         case RS2_EXTENSION_DEPTH_FRAME:
-            return std::make_shared<frame_archive<depth_frame>>(in_max_frame_queue_size, ts, parsers);
+            return make_frame_archive<depth_frame>(in_max_frame_queue_size, ts, parsers, allocator, stats);
 
         case RS2_EXTENSION_POSE_FRAME:
-            return std::make_shared<frame_archive<pose_frame>>(in_max_frame_queue_size, ts, parsers);
+            return make_frame_archive<pose_frame>(in_max_frame_queue_size, ts, parsers, allocator, stats);
 
         case RS2_EXTENSION_DISPARITY_FRAME:
-            return std::make_shared<frame_archive<disparity_frame>>(in_max_frame_queue_size, ts, parsers);
+            return make_frame_archive<disparity_frame>(in_max_frame_queue_size, ts, parsers, allocator, stats);
 
         default:
             throw std::runtime_error("Requested frame type is not supported!");
         }
     }
+
+    int latency_histogram::get_bucket(uint64_t value)
+    {
+        value = std::min<uint64_t>(value, (1ull << max_value_bits) - 1);
+        int shift = 0;
+        while ((value >> shift) >= (2ull << sub_bucket_bits)) ++shift;
+        if (value < (1ull << sub_bucket_bits)) return static_cast<int>(value);
+        return ((shift + 1) << sub_bucket_bits) + static_cast<int>((value >> shift) - (1ull << sub_bucket_bits));
+    }
+
+    uint64_t latency_histogram::get_highest_value(int bucket)
+    {
+        if (bucket < (1 << sub_bucket_bits)) return bucket;
+        auto shift = (bucket >> sub_bucket_bits) - 1;
+        uint64_t mantissa = (1 << sub_bucket_bits) + (bucket & ((1 << sub_bucket_bits) - 1));
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    void latency_histogram::record(rs2_time_t latency)
+    {
+        auto value = static_cast<uint64_t>(std::max(latency, 0.) * 1000 + 0.5);
+
+        _buckets[get_bucket(value)].fetch_add(1, std::memory_order_relaxed);
+        _sum.fetch_add(value, std::memory_order_relaxed);
+        auto min = _min.load(std::memory_order_relaxed);
+        while (value < min && !_min.compare_exchange_weak(min, value, std::memory_order_relaxed));
+        auto max = _max.load(std::memory_order_relaxed);
+        while (value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed));
+        _count.fetch_add(1, std::memory_order_release);
+    }
+
+    rs2_latency_stats latency_histogram::get() const
+    {
+        rs2_latency_stats stats{};
+        stats.count = _count.load(std::memory_order_acquire);
+        if (!stats.count) return stats;
+
+        auto max = _max.load(std::memory_order_relaxed);
+        stats.min = _min.load(std::memory_order_relaxed) / 1000.;
+        stats.max = max / 1000.;
+        stats.mean = _sum.load(std::memory_order_relaxed) / 1000. / stats.count;
+
+        // Frames recorded while walking the buckets are not part of count, so the walk stops at the last bucket
+        std::pair<double, double*> percentiles[] = { { 0.5, &stats.p50 }, { 0.9, &stats.p90 }, { 0.99, &stats.p99 }, { 0.999, &stats.p999 } };
+        unsigned long long seen = 0;
+        auto next = std::begin(percentiles);
+        for (int bucket = 0; bucket < bucket_count && next != std::end(percentiles); ++bucket)
+        {
+            seen += _buckets[bucket].load(std::memory_order_relaxed);
+            while (next != std::end(percentiles) && (seen >= next->first * stats.count || bucket == bucket_count - 1))
+            {
+                *next->second = std::min<uint64_t>(get_highest_value(bucket), max) / 1000.;
+                ++next;
+            }
+        }
+        return stats;
+    }
+
+    void latency_histogram::reset()
+    {
+        for (auto&& bucket : _buckets) bucket = 0;
+        _count = 0;
+        _sum = 0;
+        _min = std::numeric_limits<unsigned long long>::max();
+        _max = 0;
+    }
+
+    void latency_statistics::stream_latency::on_callback_start(const frame_interface& frame, rs2_time_t callback_started)
+    {
+        auto arrival = frame.get_frame_system_time();
+        if (!arrival) return;
+
+        auto sensor_to_arrival = arrival - frame.get_frame_timestamp();
+        if (frame.get_frame_timestamp_domain() == RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK)
+        {
+            auto origin = clock_offset.load();
+            while (sensor_to_arrival < origin && !clock_offset.compare_exchange_weak(origin, sensor_to_arrival));
+            sensor_to_arrival -= std::min(origin, sensor_to_arrival);
+        }
+
+        histograms[RS2_LATENCY_SENSOR_TO_ARRIVAL].record(sensor_to_arrival);
+        histograms[RS2_LATENCY_ARRIVAL_TO_CALLBACK].record(callback_started - arrival);
+    }
+
+    latency_statistics::~latency_statistics()
+    {
+        auto latency = _streams.load();
+        while (latency)
+        {
+            auto next = latency->next;
+            delete latency;
+            latency = next;
+        }
+    }
+
+    latency_statistics::stream_latency* latency_statistics::find(rs2_stream stream, int index) const
+    {
+        for (auto latency = _streams.load(std::memory_order_acquire); latency; latency = latency->next)
+            if (latency->stream == stream && latency->index == index)
+                return latency;
+        return nullptr;
+    }
+
+    latency_statistics::stream_latency& latency_statistics::get(rs2_stream stream, int index)
+    {
+        if (auto latency = find(stream, index)) return *latency;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (auto latency = find(stream, index)) return *latency;
+        auto latency = new stream_latency(stream, index, _streams.load(std::memory_order_relaxed));
+        _streams.store(latency, std::memory_order_release);
+        return *latency;
+    }
+
+    rs2_latency_stats latency_statistics::get_stats(rs2_stream stream, int index, rs2_latency_type type) const
+    {
+        auto latency = find(stream, index);
+        if (!latency) return rs2_latency_stats{};
+        return latency->histograms[type].get();
+    }
+
+    void latency_statistics::reset()
+    {
+        for (auto latency = _streams.load(std::memory_order_acquire); latency; latency = latency->next)
+        {
+            for (auto&& histogram : latency->histograms) histogram.reset();
+            latency->clock_offset = std::numeric_limits<double>::max();
+        }
+    }
+}
+
+frame_metadata_blob::frame_metadata_blob(const uint8_t* md_buf, uint8_t md_size)
+    : _block(nullptr)
+{
+    if (md_size && md_buf)
+    {
+        // Copy up to 255 bytes to preserve metadata as raw data
+        auto size = std::min(md_size, MAX_META_DATA_SIZE);
+        _block = librealsense::allocate_metadata_block();
+        std::copy(md_buf, md_buf + size, _block->bytes);
+        std::fill(_block->bytes + size, _block->bytes + MAX_META_DATA_SIZE, 0);
+    }
+}
+
+const uint8_t* frame_metadata_blob::data() const
+{
+    return _block ? _block->bytes : librealsense::empty_metadata();
+}
+
+uint8_t* frame_metadata_blob::data()
+{
+    if (!_block || _block->refs.load(std::memory_order_acquire) > 1)
+    {
+        auto b = librealsense::allocate_metadata_block();
+        auto current = static_cast<const frame_metadata_blob&>(*this).data();
+        std::copy(current, current + MAX_META_DATA_SIZE, b->bytes);
+        release();
+        _block = b;
+    }
+    return _block->bytes;
+}
+
+void frame_metadata_blob::release()
+{
+    if (_block && _block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        auto& heap = librealsense::metadata_heap();
+        if (heap.contains(_block)) heap.deallocate(_block);
+        else delete _block;
+    }
+    _block = nullptr;
 }
 
 void frame::release()
@@ -380,7 +752,7 @@ void frame::keep()
     }
 }
 
-frame_interface* frame::publish(std::shared_ptr<archive_interface> new_owner)
+frame_interface* frame::publish(archive_interface* new_owner)
 {
     owner = new_owner;
     _kept = false;
@@ -395,14 +767,14 @@ rs2_metadata_type frame::get_frame_metadata(const rs2_frame_metadata_value& fram
         throw invalid_value_exception(to_string() << "metadata not available for "
                                       << get_string(get_stream()->get_stream_type())<<" stream");
 
-    auto it = md_parsers.get()->find(frame_metadata);
-    if (it == md_parsers.get()->end())          // Possible user error - md attribute is not supported by this frame type
+    auto parser = md_parsers->get(frame_metadata);
+    if (!parser)          // Possible user error - md attribute is not supported by this frame type
         throw invalid_value_exception(to_string() << get_string(frame_metadata)
                                       << " attribute is not applicable for "
                                       << get_string(get_stream()->get_stream_type()) << " stream ");
 
     // Proceed to parse and extract the required data attribute
-    return it->second->get(*this);
+    return parser->get(*this);
 }
 
 bool frame::supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const
@@ -413,11 +785,36 @@ bool frame::supports_frame_metadata(const rs2_frame_metadata_value& frame_metada
     if (!md_parsers)
         return false;                         // No parsers are available or no metadata was attached
 
-    auto it = md_parsers.get()->find(frame_metadata);
-    if (it == md_parsers.get()->end())          // Possible user error - md attribute is not supported by this frame type
+    auto parser = md_parsers->get(frame_metadata);
+    if (!parser)          // Possible user error - md attribute is not supported by this frame type
         return false;
 
-    return it->second->supports(*this);
+    return parser->supports(*this);
+}
+
+int frame::get_frame_metadata_all(rs2_metadata_type* values, int* supported, int count) const
+{
+    std::fill(values, values + count, 0);
+    std::fill(supported, supported + count, 0);
+
+    auto md_parsers = owner->get_md_parsers();
+    if (!md_parsers)
+        return 0;
+
+    // The caller's count may come from an older or newer header, attributes past either end stay unsupported
+    int found = 0;
+    auto known = std::min<int>(count, RS2_FRAME_METADATA_COUNT);
+    for (int i = 0; i < known; i++)
+    {
+        auto parser = md_parsers->get(static_cast<rs2_frame_metadata_value>(i));
+        if (parser && parser->supports(*this))
+        {
+            values[i] = parser->get(*this);
+            supported[i] = 1;
+            ++found;
+        }
+    }
+    return found;
 }
 
 const byte* frame::get_frame_data() const
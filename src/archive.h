@@ -9,6 +9,10 @@
 #include <atomic>
 #include <array>
 #include <math.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
 
 namespace librealsense
 {
@@ -17,6 +21,50 @@ namespace librealsense
     class frame;
 }
 
+// Raw frame metadata, kept out-of-line in a pooled, reference-counted block of MAX_META_DATA_SIZE bytes
+// Copying the handle only bumps a reference count and moving it is a pointer swap, so passing frame
+// descriptors around no longer copies the payload. Frames without metadata share a single zeroed block
+// Writing through the non-const data() detaches the handle from any block it shares with other frames
+class frame_metadata_blob
+{
+public:
+    frame_metadata_blob() : _block(nullptr) {}
+    frame_metadata_blob(const uint8_t* md_buf, uint8_t md_size);
+
+    frame_metadata_blob(const frame_metadata_blob& other) : _block(other._block)
+    {
+        if (_block) _block->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    frame_metadata_blob(frame_metadata_blob&& other) : _block(other._block)
+    {
+        other._block = nullptr;
+    }
+
+    frame_metadata_blob& operator=(frame_metadata_blob other)
+    {
+        std::swap(_block, other._block);
+        return *this;
+    }
+
+    ~frame_metadata_blob() { release(); }
+
+    const uint8_t* data() const;
+    uint8_t* data();
+    size_t size() const { return MAX_META_DATA_SIZE; }
+
+    struct block
+    {
+        std::atomic<int> refs;
+        uint8_t bytes[MAX_META_DATA_SIZE];
+    };
+
+private:
+    void release();
+
+    block* _block;
+};
+
 struct frame_additional_data
 {
     rs2_time_t timestamp = 0;
@@ -26,7 +74,7 @@ struct frame_additional_data
     rs2_time_t      frame_callback_started = 0;
     uint32_t        metadata_size = 0;
     bool            fisheye_ae_mode = false;
-    std::array<uint8_t,MAX_META_DATA_SIZE> metadata_blob;
+    frame_metadata_blob metadata_blob;
     rs2_time_t      backend_timestamp = 0;
 
     frame_additional_data() {};
@@ -36,23 +84,130 @@ struct frame_additional_data
           frame_number(in_frame_number),
           system_time(in_system_time),
           metadata_size(md_size),
+          metadata_blob(md_buf, md_size),
           backend_timestamp(backend_time)
     {
-        // Copy up to 255 bytes to preserve metadata as raw data
-        if (metadata_size)
-            std::copy(md_buf,md_buf+ std::min(md_size,MAX_META_DATA_SIZE),metadata_blob.begin());
     }
 };
 
 namespace librealsense
 {
-    typedef std::map<rs2_frame_metadata_value, std::shared_ptr<md_attribute_parser_base>> metadata_parser_map;
+    // Upper bound on metadata attribute ids, covering both the public and the internal attributes
+    const int MAX_METADATA_ATTRIBUTES = 32;
+
+    // Dense table of metadata parsers, indexed directly by the attribute id
+    // Parsers are registered while the sensor is being constructed and only looked up afterwards
+    class metadata_parser_map
+    {
+    public:
+        const md_attribute_parser_base* get(rs2_frame_metadata_value id) const
+        {
+            if (id < 0 || id >= MAX_METADATA_ATTRIBUTES) return nullptr;
+            return _parsers[id].get();
+        }
+
+        bool contains(rs2_frame_metadata_value id) const { return get(id) != nullptr; }
+
+        void set(rs2_frame_metadata_value id, std::shared_ptr<md_attribute_parser_base> parser)
+        {
+            if (id < 0 || id >= MAX_METADATA_ATTRIBUTES)
+                throw invalid_value_exception(to_string() << "Metadata attribute id " << static_cast<int>(id) << " is out of range");
+            _parsers[id] = std::move(parser);
+        }
+
+    private:
+        std::shared_ptr<md_attribute_parser_base> _parsers[MAX_METADATA_ATTRIBUTES];
+    };
+
+    const size_t FRAME_BUFFER_ALIGNMENT = 64;
+
+    // Standard allocator routing frame buffer memory through the user-supplied frame allocator, if any
+    // The allocator travels with the buffer, so memory is always handed back to whoever provided it
+    // Library-owned buffers are cache-line aligned and elements are default-initialized rather than zeroed,
+    // since every frame buffer is overwritten by the unpacker right after it is allocated
+    template<class T>
+    class frame_buffer_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        frame_buffer_allocator() {}
+        explicit frame_buffer_allocator(frame_allocator_ptr user_allocator) : _user_allocator(std::move(user_allocator)) {}
+        template<class U>
+        frame_buffer_allocator(const frame_buffer_allocator<U>& other) : _user_allocator(other.get_user_allocator()) {}
+
+        T* allocate(size_t n)
+        {
+            void* ptr = nullptr;
+            if (_user_allocator)
+            {
+                ptr = _user_allocator->allocate(n * sizeof(T));
+            }
+            else
+            {
+#ifdef _WIN32
+                ptr = _aligned_malloc(n * sizeof(T), FRAME_BUFFER_ALIGNMENT);
+#else
+                if (posix_memalign(&ptr, FRAME_BUFFER_ALIGNMENT, n * sizeof(T))) ptr = nullptr;
+#endif
+            }
+            if (!ptr) throw std::bad_alloc();
+            return static_cast<T*>(ptr);
+        }
+
+        void deallocate(T* ptr, size_t n)
+        {
+            if (_user_allocator)
+            {
+                _user_allocator->deallocate(ptr, n * sizeof(T));
+                return;
+            }
+#ifdef _WIN32
+            _aligned_free(ptr);
+#else
+            free(ptr);
+#endif
+        }
+
+        template<class U>
+        void construct(U* ptr)
+        {
+            ::new(static_cast<void*>(ptr)) U;
+        }
+
+        template<class U, class... Args>
+        void construct(U* ptr, Args&&... args)
+        {
+            ::new(static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+        }
+
+        const frame_allocator_ptr& get_user_allocator() const { return _user_allocator; }
+
+    private:
+        frame_allocator_ptr _user_allocator;
+    };
+
+    template<class T, class U>
+    bool operator==(const frame_buffer_allocator<T>& a, const frame_buffer_allocator<U>& b)
+    {
+        return a.get_user_allocator() == b.get_user_allocator();
+    }
+
+    template<class T, class U>
+    bool operator!=(const frame_buffer_allocator<T>& a, const frame_buffer_allocator<U>& b)
+    {
+        return !(a == b);
+    }
+
+    typedef std::vector<byte, frame_buffer_allocator<byte>> frame_data;
 
     // Define a movable but explicitly noncopyable buffer type to hold our frame data
     class frame : public frame_interface
     {
     public:
-        std::vector<byte> data;
+        frame_data data;
         frame_additional_data additional_data;
 
         explicit frame() : ref_count(0), _kept(false), owner(nullptr), on_release() {}
@@ -73,13 +228,14 @@ namespace librealsense
             _kept = r._kept.exchange(false);
             on_release = std::move(r.on_release);
             additional_data = std::move(r.additional_data);
-            r.owner.reset();
+            r.owner = nullptr;
             return *this;
         }
 
         virtual ~frame() { on_release.reset(); }
         rs2_metadata_type get_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
         bool supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
+        int get_frame_metadata_all(rs2_metadata_type* values, int* supported, int count) const override;
         const byte* get_frame_data() const override;
         rs2_time_t get_frame_timestamp() const override;
         rs2_timestamp_domain get_frame_timestamp_domain() const override;
@@ -103,11 +259,11 @@ namespace librealsense
         void release() override;
         void keep() override;
 
-        frame_interface* publish(std::shared_ptr<archive_interface> new_owner) override;
+        frame_interface* publish(archive_interface* new_owner) override;
         void attach_continuation(frame_continuation&& continuation) override { on_release = std::move(continuation); }
         void disable_continuation() override { on_release.reset(); }
 
-        archive_interface* get_owner() const override { return owner.get(); }
+        archive_interface* get_owner() const override { return owner; }
 
         std::shared_ptr<sensor_interface> get_sensor() const override;
         void set_sensor(std::shared_ptr<sensor_interface> s) override;
@@ -119,13 +275,16 @@ namespace librealsense
         void mark_fixed() override { _fixed = true; }
         bool is_fixed() const override { return _fixed; }
 
+        void set_publish_time(rs2_time_t t) { _published_at = t; }
+        rs2_time_t get_publish_time() const { return _published_at; }
+
     private:
-        // TODO: check boost::intrusive_ptr or an alternative
         std::atomic<int> ref_count; // the reference count is on how many times this placeholder has been observed (not lifetime, not content)
-        std::shared_ptr<archive_interface> owner; // pointer to the owner to be returned to by last observe
+        archive_interface* owner; // pointer to the owner to be returned to by last observe. The archive stays alive as long as it has published frames
         std::weak_ptr<sensor_interface> sensor;
         frame_continuation on_release;
         bool _fixed = false;
+        rs2_time_t _published_at = 0;
         std::atomic_bool _kept;
         std::shared_ptr<stream_profile_interface> stream;
     };
@@ -182,6 +341,10 @@ namespace librealsense
         {
             return first()->supports_frame_metadata(frame_metadata);
         }
+        int get_frame_metadata_all(rs2_metadata_type* values, int* supported, int count) const override
+        {
+            return first()->get_frame_metadata_all(values, supported, count);
+        }
         const byte* get_frame_data() const override
         {
             return first()->get_frame_data();
@@ -246,7 +409,7 @@ namespace librealsense
         {
         }
         
-        frame_interface* publish(std::shared_ptr<archive_interface> new_owner) override
+        frame_interface* publish(archive_interface* new_owner) override
         {
             _depth_units = optional_value<float>();
             return video_frame::publish(new_owner);
@@ -455,7 +618,7 @@ namespace librealsense
 
         virtual frame_interface* alloc_and_track(const size_t size, const frame_additional_data& additional_data, bool requires_memory) = 0;
 
-        virtual std::shared_ptr<metadata_parser_map> get_md_parsers() const = 0;
+        virtual const metadata_parser_map* get_md_parsers() const = 0;
 
         virtual void flush() = 0;
 
@@ -467,8 +630,114 @@ namespace librealsense
 
     };
 
+    // Allocation and lifetime counters, shared by all the archives of a frame source
+    // Archives may outlive their source, so the counters are held by shared ownership
+    struct frame_statistics
+    {
+        std::atomic<unsigned long long> allocations{ 0 };
+        std::atomic<unsigned long long> buffer_reuses{ 0 };
+        std::atomic<unsigned long long> bytes_allocated{ 0 };
+        std::atomic<unsigned long long> drops{ 0 };
+        std::atomic<unsigned int> in_flight{ 0 };
+        std::atomic<unsigned int> peak_in_flight{ 0 };
+        std::atomic<unsigned long long> released{ 0 };
+        std::atomic<unsigned long long> hold_time_us{ 0 };
+
+        void on_publish()
+        {
+            auto current = in_flight.fetch_add(1) + 1;
+            auto peak = peak_in_flight.load();
+            while (current > peak && !peak_in_flight.compare_exchange_weak(peak, current));
+        }
+
+        void on_release(rs2_time_t hold_time)
+        {
+            in_flight.fetch_sub(1);
+            hold_time_us.fetch_add(static_cast<unsigned long long>(std::max(hold_time, 0.) * 1000));
+            released.fetch_add(1);
+        }
+
+        rs2_frame_stats get() const
+        {
+            auto count = released.load();
+            return{ allocations.load(), buffer_reuses.load(), bytes_allocated.load(), drops.load(),
+                    in_flight.load(), peak_in_flight.load(),
+                    count ? hold_time_us.load() / 1000. / count : 0. };
+        }
+    };
+
+    // Log-linear histogram of latencies in microseconds, in the spirit of HdrHistogram: values below 32us are
+    // counted exactly, larger ones in 32 buckets per power of two, which bounds the error of any percentile to about 3%
+    // Recording takes a few relaxed atomic increments and never allocates
+    class latency_histogram
+    {
+    public:
+        latency_histogram() { reset(); }
+
+        void record(rs2_time_t latency);
+        rs2_latency_stats get() const;
+        void reset();
+
+    private:
+        static const int sub_bucket_bits = 5;
+        static const int max_value_bits = 40;
+        static const int bucket_count = (max_value_bits - sub_bucket_bits + 1) << sub_bucket_bits;
+
+        static int get_bucket(uint64_t value);
+        static uint64_t get_highest_value(int bucket);
+
+        std::atomic<unsigned long long> _buckets[bucket_count];
+        std::atomic<unsigned long long> _count;
+        std::atomic<unsigned long long> _sum;
+        std::atomic<unsigned long long> _min;
+        std::atomic<unsigned long long> _max;
+    };
+
+    // Latency histograms of every stream a frame source publishes
+    // Streams are kept in a list that only grows at its head, so the per-frame lookup reads it without locking
+    class latency_statistics
+    {
+    public:
+        struct stream_latency
+        {
+            stream_latency(rs2_stream stream, int index, stream_latency* next) : stream(stream), index(index), next(next) {}
+
+            const rs2_stream stream;
+            const int index;
+            stream_latency* const next;
+
+            latency_histogram histograms[RS2_LATENCY_TYPE_COUNT];
+            // Smallest offset between hardware clock timestamps and host arrival, the origin of their sensor to arrival latency
+            std::atomic<double> clock_offset{ std::numeric_limits<double>::max() };
+
+            void on_callback_start(const frame_interface& frame, rs2_time_t callback_started);
+            void on_callback_end(rs2_time_t callback_started, rs2_time_t callback_ended)
+            {
+                histograms[RS2_LATENCY_CALLBACK_DURATION].record(callback_ended - callback_started);
+            }
+        };
+
+        latency_statistics() = default;
+        latency_statistics(const latency_statistics&) = delete;
+        latency_statistics& operator=(const latency_statistics&) = delete;
+        ~latency_statistics();
+
+        // Entries are never removed, so the returned reference stays valid for the lifetime of the statistics
+        stream_latency& get(rs2_stream stream, int index);
+        rs2_latency_stats get_stats(rs2_stream stream, int index, rs2_latency_type type) const;
+        void reset();
+
+    private:
+        stream_latency* find(rs2_stream stream, int index) const;
+
+        std::mutex _mutex; // serializes adding streams
+        std::atomic<stream_latency*> _streams{ nullptr };
+    };
+
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
                                                     std::atomic<uint32_t>* in_max_frame_queue_size,
                                                     std::shared_ptr<platform::time_service> ts,
-                                                    std::shared_ptr<metadata_parser_map> parsers);
+                                                    std::shared_ptr<metadata_parser_map> parsers,
+                                                    frame_allocator_ptr allocator = nullptr,
+                                                    std::shared_ptr<frame_statistics> stats = nullptr);
 }
@@ -126,6 +126,16 @@ namespace librealsense
             D3
         };
 
+        // Memory the backend captures frames into. Backends without a choice ignore it
+        enum capture_memory
+        {
+            CAPTURE_MEMORY_AUTO,    // Backend default
+            CAPTURE_MEMORY_MMAP,    // Driver buffers mapped into the process
+            CAPTURE_MEMORY_USERPTR, // Buffers allocated by the library, filled by the driver
+            CAPTURE_MEMORY_DMABUF,  // DMA buffers allocated from the system heap, imported by the driver
+            CAPTURE_MEMORY_COUNT
+        };
+
         typedef std::tuple< uint32_t, uint32_t, uint32_t, uint32_t> stream_profile_tuple;
 
         struct stream_profile
@@ -387,7 +397,9 @@ namespace librealsense
         class uvc_device
         {
         public:
-            virtual void probe_and_commit(stream_profile profile, frame_callback callback, int buffers = DEFAULT_V4L2_FRAME_BUFFERS) = 0;
+            // Returns the number of capture buffers the stream got, the driver may grant fewer than requested
+            virtual int probe_and_commit(stream_profile profile, frame_callback callback, int buffers = DEFAULT_V4L2_FRAME_BUFFERS,
+                                         capture_memory memory = CAPTURE_MEMORY_AUTO) = 0;
             virtual void stream_on(std::function<void(const notification& n)> error_handler = [](const notification& n){}) = 0;
             virtual void start_callbacks() = 0;
             virtual void stop_callbacks() = 0;
@@ -425,9 +437,9 @@ namespace librealsense
             explicit retry_controls_work_around(std::shared_ptr<uvc_device> dev)
                 : _dev(dev) {}
 
-            void probe_and_commit(stream_profile profile, frame_callback callback, int buffers) override
+            int probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory memory) override
             {
-                _dev->probe_and_commit(profile, callback, buffers);
+                return _dev->probe_and_commit(profile, callback, buffers, memory);
             }
 
             void stream_on(std::function<void(const notification& n)> error_handler = [](const notification& n){}) override
@@ -688,11 +700,11 @@ namespace librealsense
                 : _dev(dev)
             {}
 
-            void probe_and_commit(stream_profile profile, frame_callback callback, int buffers) override
+            int probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory memory) override
             {
                 auto dev_index = get_dev_index_by_profiles(profile);
                 _configured_indexes.insert(dev_index);
-                _dev[dev_index]->probe_and_commit(profile, callback, buffers);
+                return _dev[dev_index]->probe_and_commit(profile, callback, buffers, memory);
             }
 
 
@@ -8,6 +8,15 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
 
 const int QUEUE_MAX_SIZE = 10;
 // Simplest implementation of a blocking concurrent queue for thread messaging
@@ -122,6 +131,166 @@ public:
 };
 
 
+// Move-only void(Args...) callable that keeps its target in a fixed inline buffer, so that handing a task
+// to a thread does not allocate. Only targets larger than Capacity, such as the rare ones holding a whole
+// notification, are moved to the heap. Since the task is move-only, it can own a move-only object such as a frame
+template<class Signature, size_t Capacity>
+class inplace_task;
+
+template<class... Args, size_t Capacity>
+class inplace_task<void(Args...), Capacity>
+{
+    typedef typename std::aligned_storage<Capacity>::type storage;
+
+public:
+    template<class F>
+    struct fits_inline : std::integral_constant<bool, sizeof(F) <= Capacity &&
+        std::alignment_of<storage>::value % std::alignment_of<F>::value == 0> {};
+
+    inplace_task() : _ops(nullptr) {}
+
+    template<class F, class = typename std::enable_if<!std::is_same<typename std::decay<F>::type, inplace_task>::value>::type>
+    inplace_task(F&& f)
+        : _ops(nullptr)
+    {
+        typedef typename std::decay<F>::type target;
+        emplace<target>(std::forward<F>(f), fits_inline<target>());
+    }
+
+    inplace_task(inplace_task&& other)
+        : _ops(nullptr)
+    {
+        *this = std::move(other);
+    }
+
+    inplace_task& operator=(inplace_task&& other)
+    {
+        if (this != &other)
+        {
+            reset();
+            if (other._ops)
+            {
+                other._ops->move(&_storage, &other._storage);
+                _ops = other._ops;
+                other.reset();
+            }
+        }
+        return *this;
+    }
+
+    inplace_task(const inplace_task&) = delete;
+    inplace_task& operator=(const inplace_task&) = delete;
+
+    ~inplace_task() { reset(); }
+
+    void operator()(Args... args)
+    {
+        _ops->invoke(&_storage, args...);
+    }
+
+    explicit operator bool() const { return _ops != nullptr; }
+
+private:
+    struct operations
+    {
+        void(*invoke)(void* target, Args&... args);
+        void(*move)(void* to, void* from);   // move-constructs, the source is destroyed separately
+        void(*destroy)(void* target);
+    };
+
+    template<class F>
+    static const operations* operations_of()
+    {
+        struct impl
+        {
+            static void invoke(void* target, Args&... args) { (*static_cast<F*>(target))(std::move(args)...); }
+            static void move(void* to, void* from) { new (to) F(std::move(*static_cast<F*>(from))); }
+            static void destroy(void* target) { static_cast<F*>(target)->~F(); }
+        };
+        static const operations ops = { &impl::invoke, &impl::move, &impl::destroy };
+        return &ops;
+    }
+
+    template<class F>
+    struct boxed
+    {
+        std::unique_ptr<F> target;
+        void operator()(Args... args) { (*target)(std::move(args)...); }
+    };
+
+    template<class F, class G>
+    void emplace(G&& f, std::true_type)
+    {
+        new (&_storage) F(std::forward<G>(f));
+        _ops = operations_of<F>();
+    }
+
+    template<class F, class G>
+    void emplace(G&& f, std::false_type)
+    {
+        emplace<boxed<F>>(boxed<F>{ std::unique_ptr<F>(new F(std::forward<G>(f))) }, std::true_type());
+    }
+
+    void reset()
+    {
+        if (_ops)
+        {
+            _ops->destroy(&_storage);
+            _ops = nullptr;
+        }
+    }
+
+    storage _storage;
+    const operations* _ops;
+};
+
+// Runs the background work of the library, such as the tasks of dispatchers, on a shared set of threads.
+// The library uses its own work-stealing pool unless the application supplies an executor
+class executor
+{
+public:
+    typedef inplace_task<void(), 4 * sizeof(void*)> task;
+
+    // Runs task once, on some thread other than the calling one. Tasks may block for a while
+    virtual void post(task t) = 0;
+
+    // The calling thread, running a task of this executor, starts or stops waiting on something,
+    // possibly on another task. A pool can lend a thread for the meantime, so that waiting cannot starve it
+    virtual void begin_blocking() {}
+    virtual void end_blocking() {}
+
+    virtual ~executor() = default;
+};
+
+// The executor that objects created from now on run their work on
+std::shared_ptr<executor> get_executor();
+// Makes the application's executor the library's one, or restores the library's own pool when exec is null
+void set_executor(std::shared_ptr<executor> exec);
+// Replaces the library's pool with one of the given number of threads (0 for one per core), bound to the CPUs
+// set in affinity_mask (0 for any)
+void configure_executor(unsigned int threads, uint64_t affinity_mask);
+
+// Runs task on the library's timer thread once delay elapsed, unless cancelled
+void schedule_after(std::chrono::milliseconds delay, const void* owner, executor::task task);
+// Cancels the tasks scheduled for owner, waiting for one that runs at the time
+void cancel_scheduled(const void* owner);
+
+// Marks a wait of the calling thread, which may be a thread of the library's pool that other tasks depend on
+class blocking_region
+{
+public:
+    blocking_region();
+    ~blocking_region();
+
+    blocking_region(const blocking_region&) = delete;
+    blocking_region& operator=(const blocking_region&) = delete;
+
+private:
+    executor* _executor;
+};
+
+// Runs the tasks invoked on it one at a time and in order, on an executor rather than on a thread of its own:
+// while tasks are pending, exactly one job draining them is posted to the executor
 class dispatcher
 {
 public:
@@ -136,6 +305,7 @@ public:
         {
             using namespace std::chrono;
 
+            blocking_region blocking;
             std::unique_lock<std::mutex> lock(_owner->_was_stopped_mutex);
             auto good = [&]() { return _owner->_was_stopped.load(); };
             return !(_owner->_was_stopped_cv.wait_for(lock, milliseconds(ms), good));
@@ -145,34 +315,18 @@ public:
         dispatcher* _owner;
     };
 
-    dispatcher(unsigned int cap)
+    // Large enough for the tasks of the library: a few pointers, a frame and a callback
+    static const size_t task_capacity = sizeof(std::function<void()>) + 4 * sizeof(void*);
+    typedef inplace_task<void(cancellable_timer), task_capacity> task;
+
+    explicit dispatcher(unsigned int cap, std::shared_ptr<executor> exec = get_executor())
         : _queue(cap),
+          _executor(std::move(exec)),
           _was_stopped(true),
-          _was_flushed(false),
-          _is_alive(true)
+          _scheduled(false),
+          _drain_thread(std::thread::id()),
+          _next_delayed(0)
     {
-        _thread = std::thread([&]()
-        {
-            while (_is_alive)
-            {
-                std::function<void(cancellable_timer)> item;
-
-                if (_queue.dequeue(&item))
-                {
-                    cancellable_timer time(this);
-                    item(time);
-                }
-
-#ifndef ANDROID
-                std::unique_lock<std::mutex> lock(_was_flushed_mutex);
-#endif
-                _was_flushed = true;
-                _was_flushed_cv.notify_all();
-#ifndef ANDROID
-                lock.unlock();
-#endif
-            }
-        });
     }
 
     template<class T>
@@ -180,7 +334,21 @@ public:
     {
         if (!_was_stopped)
         {
-            _queue.enqueue(std::move(item));
+            _queue.enqueue(task(std::move(item)));
+            schedule();
+        }
+    }
+
+    // Invokes item once delay elapsed, unless the dispatcher stops in the meantime
+    template<class T>
+    void invoke_after(std::chrono::milliseconds delay, T item)
+    {
+        if (!_was_stopped)
+        {
+            std::lock_guard<std::mutex> lock(_delayed_mutex);
+            auto id = _next_delayed++;
+            _delayed.emplace_back(id, task(std::move(item)));
+            schedule_after(delay, this, delayed_task{ this, id });
         }
     }
 
@@ -202,13 +370,19 @@ public:
 
         _queue.clear();
 
+        // Wait for the task being run, unless it is the one stopping us
+        if (_drain_thread.load() != std::this_thread::get_id())
         {
-            std::unique_lock<std::mutex> lock(_was_flushed_mutex);
-            _was_flushed = false;
+            blocking_region blocking;
+            std::unique_lock<std::mutex> lock(_drain_mutex);
+            _drained_cv.wait(lock, [&]() { return !_scheduled.load(); });
         }
 
-        std::unique_lock<std::mutex> lock_was_flushed(_was_flushed_mutex);
-        _was_flushed_cv.wait_for(lock_was_flushed, std::chrono::hours(999999), [&]() { return _was_flushed.load(); });
+        cancel_scheduled(this);
+        {
+            std::lock_guard<std::mutex> lock(_delayed_mutex);
+            _delayed.clear();
+        }
 
         _queue.start();
     }
@@ -217,8 +391,6 @@ public:
     {
         stop();
         _queue.clear();
-        _is_alive = false;
-        _thread.join();
     }
 
     bool flush()
@@ -233,38 +405,129 @@ public:
             if (_was_stopped || !(*wait_sucess))
                 return;
 
-            {
-                std::lock_guard<std::mutex> locker(m);
-                invoked = true;
-            }
+            // Notify under the lock, since the flushing thread destroys cv as soon as it sees invoked
+            std::lock_guard<std::mutex> locker(m);
+            invoked = true;
             cv.notify_one();
         });
+        blocking_region blocking;
         std::unique_lock<std::mutex> locker(m);
         *wait_sucess = cv.wait_for(locker, std::chrono::seconds(10), [&]() { return invoked || _was_stopped; });
         return *wait_sucess;
     }
 private:
     friend cancellable_timer;
-    single_consumer_queue<std::function<void(cancellable_timer)>> _queue;
-    std::thread _thread;
+
+    // Bounds a drain job, so that a busy dispatcher lets the others of its executor run in between
+    static const int max_drain_batch = 16;
+
+    // An application's executor may delete the job without running it, which then leaves the dispatcher
+    // unscheduled, so that the next invoke posts another job and stop does not wait for this one
+    struct drain_task
+    {
+        dispatcher* owner;
+        bool ran;
+
+        explicit drain_task(dispatcher* owner) : owner(owner), ran(false) {}
+        drain_task(drain_task&& other) : owner(other.owner), ran(other.ran) { other.ran = true; }
+        drain_task(const drain_task&) = delete;
+
+        ~drain_task()
+        {
+            if (!ran)
+                owner->abandon_drain();
+        }
+
+        void operator()()
+        {
+            ran = true;
+            owner->drain();
+        }
+    };
+
+    struct delayed_task
+    {
+        dispatcher* owner;
+        uint64_t id;
+        void operator()() { owner->invoke_delayed(id); }
+    };
+
+    void schedule()
+    {
+        if (!_scheduled.exchange(true))
+            _executor->post(drain_task{ this });
+    }
+
+    void drain()
+    {
+        _drain_thread = std::this_thread::get_id();
+        for (int i = 0; i < max_drain_batch; ++i)
+        {
+            task item;
+            if (!_queue.try_dequeue(&item))
+                break;
+
+            cancellable_timer time(this);
+            item(time);
+        }
+        _drain_thread = std::thread::id();
+
+        // A task invoked after the last try_dequeue either finds the job unscheduled and posts one, or is seen here.
+        // The lock keeps stop and the destructor waiting until we are done with this
+        std::lock_guard<std::mutex> lock(_drain_mutex);
+        _scheduled = false;
+        if (_queue.size() > 0 && !_scheduled.exchange(true))
+            _executor->post(drain_task{ this });
+        else
+            _drained_cv.notify_all();
+    }
+
+    void abandon_drain()
+    {
+        std::lock_guard<std::mutex> lock(_drain_mutex);
+        _scheduled = false;
+        _drained_cv.notify_all();
+    }
+
+    void invoke_delayed(uint64_t id)
+    {
+        task item;
+        {
+            std::lock_guard<std::mutex> lock(_delayed_mutex);
+            auto it = std::find_if(_delayed.begin(), _delayed.end(),
+                [id](const std::pair<uint64_t, task>& d) { return d.first == id; });
+            if (it == _delayed.end())
+                return;
+            item = std::move(it->second);
+            _delayed.erase(it);
+        }
+        invoke(std::move(item));
+    }
+
+    single_consumer_queue<task> _queue;
+    std::shared_ptr<executor> _executor;
 
     std::atomic<bool> _was_stopped;
     std::condition_variable _was_stopped_cv;
     std::mutex _was_stopped_mutex;
 
-    std::atomic<bool> _was_flushed;
-    std::condition_variable _was_flushed_cv;
-    std::mutex _was_flushed_mutex;
+    std::atomic<bool> _scheduled;                   // a drain job is posted or running
+    std::atomic<std::thread::id> _drain_thread;
+    std::condition_variable _drained_cv;
+    std::mutex _drain_mutex;
 
-    std::atomic<bool> _is_alive;
+    std::vector<std::pair<uint64_t, task>> _delayed;
+    uint64_t _next_delayed;
+    std::mutex _delayed_mutex;
 };
 
 template<class T = std::function<void(dispatcher::cancellable_timer)>>
 class active_object
 {
 public:
-    active_object(T operation)
-        : _operation(std::move(operation)), _dispatcher(1), _stopped(true)
+    // Runs operation over and over, waiting for period before each run. The wait takes no thread
+    active_object(T operation, std::chrono::milliseconds period = std::chrono::milliseconds(0))
+        : _operation(std::move(operation)), _period(period), _dispatcher(1), _stopped(true)
     {
     }
 
@@ -289,17 +552,257 @@ public:
 private:
     void do_loop()
     {
-        _dispatcher.invoke([this](dispatcher::cancellable_timer ct)
+        auto loop = [this](dispatcher::cancellable_timer ct)
         {
             _operation(ct);
             if (!_stopped)
             {
                 do_loop();
             }
-        });
+        };
+
+        if (_period.count() > 0)
+            _dispatcher.invoke_after(_period, loop);
+        else
+            _dispatcher.invoke(loop);
     }
 
     T _operation;
+    std::chrono::milliseconds _period;
     dispatcher _dispatcher;
     std::atomic<bool> _stopped;
 };
+
+// Fixed set of worker threads that split data-parallel jobs (such as unpacking one frame in row bands)
+// with the thread submitting them. Several threads may submit jobs at the same time.
+class parallel_pool
+{
+public:
+    explicit parallel_pool(unsigned int threads)
+        : _stopping(false)
+    {
+        for (unsigned int i = 0; i < threads; ++i)
+            _threads.emplace_back([this]() { worker(); });
+    }
+
+    // Runs work(0) .. work(count - 1) on the pool and the calling thread, and returns once all of them completed.
+    // work must not throw.
+    template<class T>
+    void parallel_for(int count, T& work)
+    {
+        job j;
+        j.invoke = [](void* context, int index) { (*static_cast<T*>(context))(index); };
+        j.context = &work;
+        j.count = count;
+        j.next = 0;
+        j.remaining = count;
+        j.workers = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _jobs.push_back(&j);
+        }
+        _work_cv.notify_all();
+
+        run(j);
+
+        // Workers still inside the job may touch it until they leave, so wait for them as well
+        std::unique_lock<std::mutex> lock(_mutex);
+        _jobs.erase(std::remove(_jobs.begin(), _jobs.end(), &j), _jobs.end());
+        _done_cv.wait(lock, [&]() { return j.remaining == 0 && j.workers == 0; });
+    }
+
+    size_t size() const { return _threads.size(); }
+
+    ~parallel_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _work_cv.notify_all();
+        for (auto&& t : _threads)
+            t.join();
+    }
+
+private:
+    struct job
+    {
+        void(*invoke)(void* context, int index);
+        void* context;
+        int count;
+        std::atomic<int> next;
+        std::atomic<int> remaining;
+        int workers; // guarded by _mutex
+    };
+
+    void run(job& j)
+    {
+        int index;
+        while ((index = j.next++) < j.count)
+        {
+            j.invoke(j.context, index);
+            if (--j.remaining == 0)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _done_cv.notify_all();
+            }
+        }
+    }
+
+    void worker()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+            _work_cv.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+            if (_stopping)
+                return;
+
+            auto j = _jobs.front();
+            if (j->next >= j->count)
+            {
+                // Every part of this job is taken, leave the rest to the threads running them
+                _jobs.pop_front();
+                continue;
+            }
+
+            ++j->workers;
+            lock.unlock();
+            run(*j);
+            lock.lock();
+            if (--j->workers == 0)
+                _done_cv.notify_all();
+        }
+    }
+
+    std::vector<std::thread> _threads;
+    std::deque<job*> _jobs;
+    std::mutex _mutex;
+    std::condition_variable _work_cv;
+    std::condition_variable _done_cv;
+    bool _stopping;
+};
+
+// What a bounded queue does with an item that arrives while it is full
+enum queue_overflow_policy
+{
+    QUEUE_DROP_OLDEST, // Discard the oldest queued item to make room
+    QUEUE_DROP_NEWEST, // Discard the arriving item
+    QUEUE_BLOCK,       // Wait for the consumer to make room
+    QUEUE_OVERFLOW_POLICY_COUNT
+};
+
+// Hands items from producers over to a dedicated thread through a queue of at most cap items.
+// Every item is either processed or discarded exactly once. Discarding runs on the thread that gives up on the item
+template<class T>
+class bounded_worker
+{
+public:
+    bounded_worker(unsigned int cap, queue_overflow_policy policy,
+                   std::function<void(T&)> process, std::function<void(T&)> discard)
+        : _cap(std::max(cap, 1u)), _policy(policy), _process(std::move(process)), _discard(std::move(discard)),
+          _busy(false), _stopping(false)
+    {
+        _thread = std::thread([this]() { run(); });
+    }
+
+    void invoke(T&& item)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_policy == QUEUE_BLOCK)
+            _not_full_cv.wait(lock, [this]() { return _queue.size() < _cap || _stopping; });
+
+        if (_stopping || (_queue.size() >= _cap && _policy == QUEUE_DROP_NEWEST))
+        {
+            lock.unlock();
+            _discard(item);
+            return;
+        }
+
+        _queue.push_back(std::move(item));
+        if (_queue.size() > _cap)
+        {
+            auto oldest = std::move(_queue.front());
+            _queue.pop_front();
+            lock.unlock();
+            _not_empty_cv.notify_one();
+            _discard(oldest);
+            return;
+        }
+        lock.unlock();
+        _not_empty_cv.notify_one();
+    }
+
+    // Discards the queued items and waits for the item being processed, if any
+    void flush()
+    {
+        std::deque<T> dropped;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            dropped.swap(_queue);
+            _not_full_cv.notify_all();
+            _idle_cv.wait(lock, [this]() { return !_busy; });
+        }
+        for (auto&& item : dropped)
+            _discard(item);
+    }
+
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _queue.size();
+    }
+
+    ~bounded_worker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _not_empty_cv.notify_all();
+        _not_full_cv.notify_all();
+        _thread.join();
+
+        for (auto&& item : _queue)
+            _discard(item);
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+            _not_empty_cv.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+            if (_stopping)
+                return;
+
+            auto item = std::move(_queue.front());
+            _queue.pop_front();
+            _busy = true;
+            lock.unlock();
+            _not_full_cv.notify_one();
+
+            _process(item);
+
+            lock.lock();
+            _busy = false;
+            _idle_cv.notify_all();
+        }
+    }
+
+    const size_t _cap;
+    const queue_overflow_policy _policy;
+    std::function<void(T&)> _process;
+    std::function<void(T&)> _discard;
+
+    std::deque<T> _queue;
+    std::mutex _mutex;
+    std::condition_variable _not_empty_cv;
+    std::condition_variable _not_full_cv;
+    std::condition_variable _idle_cv;
+    bool _busy;
+    bool _stopping;
+    std::thread _thread;
+};
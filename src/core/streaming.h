@@ -65,6 +65,7 @@ namespace librealsense
     public:
         virtual rs2_metadata_type get_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const = 0;
         virtual bool supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const = 0;
+        virtual int get_frame_metadata_all(rs2_metadata_type* values, int* supported, int count) const = 0;
         virtual const byte* get_frame_data() const = 0;
         //TODO: add virtual uint64_t get_frame_data_size() const = 0;
         virtual rs2_time_t get_frame_timestamp() const = 0;
@@ -83,7 +84,7 @@ namespace librealsense
 
         virtual void acquire() = 0;
         virtual void release() = 0;
-        virtual frame_interface* publish(std::shared_ptr<archive_interface> new_owner) = 0;
+        virtual frame_interface* publish(archive_interface* new_owner) = 0;
         virtual void attach_continuation(frame_continuation&& continuation) = 0;
         virtual void disable_continuation() = 0;
 
@@ -120,6 +121,10 @@ namespace librealsense
         virtual frame_callback_ptr get_frames_callback() const = 0;
         virtual void set_frames_callback(frame_callback_ptr cb) = 0;
         virtual bool is_streaming() const = 0;
+        virtual void set_frame_allocator(frame_allocator_ptr allocator) = 0;
+        virtual rs2_frame_stats get_frame_stats() const = 0;
+        virtual rs2_latency_stats get_latency_stats(rs2_stream stream, int index, rs2_latency_type type) const = 0;
+        virtual void reset_latency_stats() = 0;
 
         virtual const device_interface& get_device() = 0;
 
@@ -80,7 +80,10 @@ namespace librealsense
             std::shared_ptr<platform::uvc_device> uvc_device,
             std::unique_ptr<frame_timestamp_reader> timestamp_reader)
             : uvc_sensor(ds::DEPTH_STEREO, uvc_device, move(timestamp_reader), owner), _owner(owner), _depth_units(0)
-        {}
+        {
+            // Z16 and Y8 frames were always copied, keep it that way unless the application turns zero-copy on
+            set_zero_copy_default(false);
+        }
 
         rs2_intrinsics get_intrinsics(const stream_profile& profile) const override
         {
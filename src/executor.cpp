@@ -0,0 +1,361 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "concurrency.h"
+#include "types.h"
+
+#include <map>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+    thread_local executor* current_executor = nullptr;
+
+    void set_thread_affinity(std::thread& thread, uint64_t affinity_mask)
+    {
+        if (!affinity_mask) return;
+#ifdef _WIN32
+        if (!SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(affinity_mask)))
+            LOG_WARNING("Could not set the CPU affinity of an executor thread");
+#elif defined(__linux__) && !defined(ANDROID)
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (int cpu = 0; cpu < 64; ++cpu)
+            if (affinity_mask & (uint64_t(1) << cpu)) CPU_SET(cpu, &cpus);
+        if (pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus))
+            LOG_WARNING("Could not set the CPU affinity of an executor thread");
+#else
+        LOG_WARNING("CPU affinity of executor threads is not supported on this platform");
+#endif
+    }
+
+    // Work-stealing pool: every worker takes the oldest task of its own queue, and once it is empty,
+    // the newest of another worker's. Tasks posted by a worker go to its own queue, the others are spread.
+    // While workers block, spare threads join in, and leave again after a second without work
+    class thread_pool_executor : public executor
+    {
+    public:
+        thread_pool_executor(unsigned int threads, uint64_t affinity_mask)
+            : _queues(threads), _affinity_mask(affinity_mask), _next_queue(0), _pending(0),
+              _idle(0), _running(threads), _blocked(0), _stopping(false)
+        {
+            for (unsigned int i = 0; i < threads; ++i)
+            {
+                _threads.emplace_back([this, i]() { work(static_cast<int>(i)); });
+                set_thread_affinity(_threads.back(), _affinity_mask);
+            }
+        }
+
+        ~thread_pool_executor()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleep_mutex);
+                _stopping = true;
+            }
+            _sleep_cv.notify_all();
+            for (auto&& t : _threads)
+                t.join();
+
+            // Spare threads are detached, wait for them to leave as well
+            std::unique_lock<std::mutex> lock(_sleep_mutex);
+            _sleep_cv.wait(lock, [this]() { return _running == 0; });
+        }
+
+        void post(task t) override
+        {
+            auto index = current_executor == this && current_queue >= 0
+                ? static_cast<size_t>(current_queue)
+                : _next_queue++ % _queues.size();
+            {
+                auto& q = _queues[index];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                q.tasks.push_back(std::move(t));
+            }
+
+            // Pairs with the idle count of a worker going to sleep: either it sees the task, or we see it sleeping
+            ++_pending;
+            if (_idle.load() > 0)
+            {
+                { std::lock_guard<std::mutex> lock(_sleep_mutex); }
+                _sleep_cv.notify_one();
+            }
+        }
+
+        void begin_blocking() override
+        {
+            auto blocked = ++_blocked;
+            std::lock_guard<std::mutex> lock(_sleep_mutex);
+            if (!_stopping && _running - blocked < static_cast<int>(_queues.size()))
+            {
+                ++_running;
+                std::thread spare([this]() { work(-1); });
+                set_thread_affinity(spare, _affinity_mask);
+                spare.detach();
+            }
+        }
+
+        void end_blocking() override
+        {
+            --_blocked;
+        }
+
+    private:
+        struct worker_queue
+        {
+            std::mutex mutex;
+            std::deque<task> tasks;
+        };
+
+        static thread_local int current_queue;
+
+        bool try_take(int own, task& t)
+        {
+            if (own >= 0)
+            {
+                auto& q = _queues[own];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                if (!q.tasks.empty())
+                {
+                    t = std::move(q.tasks.front());
+                    q.tasks.pop_front();
+                    return true;
+                }
+            }
+
+            auto first = own >= 0 ? static_cast<size_t>(own) + 1 : 0;
+            for (size_t i = 0; i < _queues.size(); ++i)
+            {
+                auto& q = _queues[(first + i) % _queues.size()];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                if (!q.tasks.empty())
+                {
+                    t = std::move(q.tasks.back());
+                    q.tasks.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // own is the index of the worker's queue, or -1 for a spare thread
+        void work(int own)
+        {
+            current_executor = this;
+            current_queue = own;
+
+            while (true)
+            {
+                task t;
+                if (try_take(own, t))
+                {
+                    --_pending;
+                    t();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(_sleep_mutex);
+                ++_idle;
+                auto ready = [this]() { return _pending.load() > 0 || _stopping; };
+                auto woken = true;
+                if (own >= 0)
+                    _sleep_cv.wait(lock, ready);
+                else
+                    woken = _sleep_cv.wait_for(lock, std::chrono::seconds(1), ready);
+                --_idle;
+
+                if ((_stopping && _pending.load() == 0) ||
+                    (!woken && _running - _blocked.load() > static_cast<int>(_queues.size())))
+                {
+                    --_running;
+                    _sleep_cv.notify_all();
+                    return;
+                }
+            }
+        }
+
+        std::vector<worker_queue> _queues;
+        std::vector<std::thread> _threads;
+        const uint64_t _affinity_mask;
+        std::atomic<size_t> _next_queue;
+        std::atomic<int> _pending;      // tasks posted and not taken yet
+        std::atomic<int> _idle;         // threads waiting for tasks
+        int _running;                   // worker and spare threads, guarded by _sleep_mutex
+        std::atomic<int> _blocked;      // threads inside a blocking_region
+        bool _stopping;                 // guarded by _sleep_mutex
+        std::mutex _sleep_mutex;
+        std::condition_variable _sleep_cv;
+    };
+
+    thread_local int thread_pool_executor::current_queue = -1;
+
+    struct executor_settings
+    {
+        std::mutex mutex;
+        std::shared_ptr<executor> current;
+        unsigned int threads = 0;
+        uint64_t affinity_mask = 0;
+    };
+
+    executor_settings& get_settings()
+    {
+        static executor_settings settings;
+        return settings;
+    }
+
+    std::shared_ptr<executor> make_pool(unsigned int threads, uint64_t affinity_mask)
+    {
+        if (!threads) threads = std::max(std::thread::hardware_concurrency(), 2u);
+
+        // The last reference may go away in a task of the pool itself, which cannot wait for its own thread
+        return std::shared_ptr<executor>(new thread_pool_executor(threads, affinity_mask), [](executor* pool)
+        {
+            if (current_executor == pool)
+                std::thread([pool]() { delete pool; }).detach();
+            else
+                delete pool;
+        });
+    }
+
+    // Runs the tasks scheduled with a delay, such as the next run of an active_object, on a single thread
+    class timer_thread
+    {
+    public:
+        timer_thread() : _stopping(false) {}
+
+        ~timer_thread()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _cv.notify_all();
+            if (_thread.joinable())
+                _thread.join();
+        }
+
+        void schedule(std::chrono::milliseconds delay, const void* owner, executor::task task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_thread.joinable())
+                    _thread = std::thread([this]() { run(); });
+                _entries.emplace(std::chrono::steady_clock::now() + delay, entry{ owner, std::move(task) });
+            }
+            _cv.notify_all();
+        }
+
+        void cancel(const void* owner)
+        {
+            std::lock_guard<std::mutex> running(_running_mutex);
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto it = _entries.begin(); it != _entries.end();)
+            {
+                if (it->second.owner == owner) it = _entries.erase(it);
+                else ++it;
+            }
+        }
+
+    private:
+        struct entry
+        {
+            const void* owner;
+            executor::task task;
+        };
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (!_stopping)
+            {
+                if (_entries.empty())
+                {
+                    _cv.wait(lock);
+                    continue;
+                }
+                auto due = _entries.begin()->first;
+                if (due > std::chrono::steady_clock::now())
+                {
+                    _cv.wait_until(lock, due);
+                    continue;
+                }
+
+                // cancel takes _running_mutex first, so that it waits for the task running at the time
+                lock.unlock();
+                std::lock_guard<std::mutex> running(_running_mutex);
+                lock.lock();
+                if (_entries.empty() || _entries.begin()->first > std::chrono::steady_clock::now())
+                    continue;
+                auto task = std::move(_entries.begin()->second.task);
+                _entries.erase(_entries.begin());
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+
+        std::multimap<std::chrono::steady_clock::time_point, entry> _entries;
+        std::mutex _mutex;
+        std::mutex _running_mutex;
+        std::condition_variable _cv;
+        std::thread _thread;
+        bool _stopping;
+    };
+
+    timer_thread& get_timer()
+    {
+        static timer_thread timer;
+        return timer;
+    }
+}
+
+std::shared_ptr<executor> get_executor()
+{
+    auto& settings = get_settings();
+    std::lock_guard<std::mutex> lock(settings.mutex);
+    if (!settings.current)
+        settings.current = make_pool(settings.threads, settings.affinity_mask);
+    return settings.current;
+}
+
+void set_executor(std::shared_ptr<executor> exec)
+{
+    auto& settings = get_settings();
+    std::lock_guard<std::mutex> lock(settings.mutex);
+    settings.current = exec;
+}
+
+void configure_executor(unsigned int threads, uint64_t affinity_mask)
+{
+    auto& settings = get_settings();
+    std::lock_guard<std::mutex> lock(settings.mutex);
+    settings.threads = threads;
+    settings.affinity_mask = affinity_mask;
+    settings.current = make_pool(threads, affinity_mask);
+}
+
+void schedule_after(std::chrono::milliseconds delay, const void* owner, executor::task task)
+{
+    get_timer().schedule(delay, owner, std::move(task));
+}
+
+void cancel_scheduled(const void* owner)
+{
+    get_timer().cancel(owner);
+}
+
+blocking_region::blocking_region()
+    : _executor(current_executor)
+{
+    if (_executor) _executor->begin_blocking();
+}
+
+blocking_region::~blocking_region()
+{
+    if (_executor) _executor->end_blocking();
+}
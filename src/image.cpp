@@ -6,8 +6,20 @@
 #include "image.h"
 //#include "../include/librealsense2/rsutil.h" // For projection/deprojection logic
 
-#ifdef __SSSE3__
-#include <tmmintrin.h> // For SSE3 intrinsic used in unpack_yuy2_sse
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define RS2_SIMD_DISPATCH // SIMD unpackers are always built on x86 and picked at runtime according to the CPU
+#include <immintrin.h> // For SSSE3/AVX2/AVX-512 intrinsics used in the unpack_*_ssse3/avx2/avx512 routines
+#ifdef _MSC_VER
+#include <intrin.h> // For __cpuidex and _xgetbv
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SIMD_TARGET(isa) // MSVC exposes all intrinsics regardless of the /arch setting
 #endif
 
 #pragma pack(push, 1) // All structs in this file are assumed to be byte-packed
@@ -22,6 +34,7 @@ namespace librealsense
     {
         if (format == RS2_FORMAT_YUYV || (format == RS2_FORMAT_UYVY)) assert(width % 2 == 0);
         if (format == RS2_FORMAT_RAW10) assert(width % 4 == 0);
+        if (format == RS2_FORMAT_NV12 || (format == RS2_FORMAT_I420)) assert(width % 2 == 0 && height % 2 == 0);
         return width * height * get_image_bpp(format) / 8;
     }
 
@@ -48,9 +61,92 @@ namespace librealsense
         case RS2_FORMAT_MOTION_RAW: return 1;
         case RS2_FORMAT_MOTION_XYZ32F: return 1;
         case RS2_FORMAT_6DOF: return 1;
+        case RS2_FORMAT_NV12: return 12;
+        case RS2_FORMAT_I420: return 12;
         default: assert(false); return 0;
         }
     }
+
+    int get_image_stride(int width, rs2_format format)
+    {
+        // The planar formats are described by their luminance plane, the chroma planes follow it
+        if (format == RS2_FORMAT_NV12 || format == RS2_FORMAT_I420) return width;
+        return width * get_image_bpp(format) / 8;
+    }
+
+    ///////////////////////////
+    // Runtime SIMD dispatch //
+    ///////////////////////////
+
+    typedef void(*unpack_function)(byte * const dest[], const byte * source, int count);
+    typedef void(*unpack_frame_function)(byte * const dest[], const byte * source, int width, int height);
+
+#ifdef RS2_SIMD_DISPATCH
+    enum class simd_level { none, ssse3, avx2, avx512 };
+
+    static void cpuid(uint32_t leaf, uint32_t regs[4])
+    {
+#ifdef _MSC_VER
+        __cpuidex(reinterpret_cast<int *>(regs), leaf, 0);
+#else
+        __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    static uint64_t xgetbv()
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        uint32_t lo, hi;
+        __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+        return (static_cast<uint64_t>(hi) << 32) | lo;
+#endif
+    }
+
+    // Query the CPU (and whether the OS saves the wider registers on context switch) for the best unpacker family it can run
+    static simd_level detect_simd_level()
+    {
+        uint32_t regs[4];
+        cpuid(0, regs);
+        auto max_leaf = regs[0];
+
+        cpuid(1, regs);
+        bool ssse3 = (regs[2] & (1 << 9)) != 0;
+        bool osxsave_avx = (regs[2] & (1 << 27)) && (regs[2] & (1 << 28));
+        if (!ssse3) return simd_level::none;
+        if (!osxsave_avx || max_leaf < 7) return simd_level::ssse3;
+
+        auto xcr0 = xgetbv();
+        if ((xcr0 & 0x06) != 0x06) return simd_level::ssse3;           // XMM and YMM state
+
+        cpuid(7, regs);
+        bool avx2 = (regs[1] & (1 << 5)) != 0;
+        bool avx512 = (regs[1] & (1 << 16)) && (regs[1] & (1 << 30)) && (regs[1] & (1u << 31)); // F, BW and VL
+        if (!avx2) return simd_level::ssse3;
+        if (avx512 && (xcr0 & 0xe6) == 0xe6) return simd_level::avx512; // opmask and ZMM state
+        return simd_level::avx2;
+    }
+
+    static simd_level get_simd_level()
+    {
+        static const simd_level level = detect_simd_level();
+        return level;
+    }
+
+    // The scalar routine is kept as the reference implementation and as the fallback for CPUs without SSSE3
+    template<class UNPACK> static UNPACK select_unpacker(UNPACK scalar, UNPACK ssse3, UNPACK avx2, UNPACK avx512)
+    {
+        switch (get_simd_level())
+        {
+        case simd_level::avx512: return avx512;
+        case simd_level::avx2:   return avx2;
+        case simd_level::ssse3:  return ssse3;
+        default:                 return scalar;
+        }
+    }
+#endif
+
     //////////////////////////////
     // Naive unpacking routines //
     //////////////////////////////
@@ -134,7 +230,41 @@ namespace librealsense
     void unpack_y8_from_y16_10 (byte * const d[], const byte * s, int n) { unpack_pixels(d, n, reinterpret_cast<const uint16_t *>(s), [](uint16_t pixel) -> uint8_t  { return pixel >> 2; }); }
     void unpack_rw10_from_rw8 (byte *  const d[], const byte * s, int n)
     {
-#ifdef __SSSE3__
+        unsigned short* from = (unsigned short*)s;
+        byte* to = d[0];
+
+        for(int i = 0; i < n; ++i)
+        {
+          byte temp = (byte)(*from >> 2);
+          *to = temp;
+          ++from;
+          ++to;
+        }
+    }
+
+    // Unpack luminocity 8 bit from 10-bit packed macro-pixels (4 pixels in 5 bytes):
+    // The first four bytes store the 8 MSB of each pixel, and the last byte holds the 2 LSB for each pixel :8888[2222]
+    void unpack_y8_from_rw10(byte *  const d[], const byte * s, int n)
+    {
+        auto from = reinterpret_cast<const uint8_t *>(s);
+        uint8_t* tgt = d[0];
+
+        int i = 0;
+        for (; i + 4 <= n; i+=4, from+=5)
+        {
+            *tgt++ = from[0];
+            *tgt++ = from[1];
+            *tgt++ = from[2];
+            *tgt++ = from[3];
+        }
+        // A partial macro-pixel only yields the pixels asked for
+        for (auto j = 0; i < n; ++i, ++j)
+            *tgt++ = from[j];
+    }
+
+#ifdef RS2_SIMD_DISPATCH
+    SIMD_TARGET("ssse3") void unpack_rw10_from_rw8_ssse3(byte * const d[], const byte * s, int n)
+    {
         auto src = reinterpret_cast<const __m128i *>(s);
         auto dst = reinterpret_cast<__m128i *>(d[0]);
 
@@ -149,26 +279,45 @@ namespace librealsense
             __m128i  out8 = _mm_packus_epi16(out1_16, out2_16);
             _mm_store_si128(xout, out8);
         }
-#else  // Generic code for when SSSE3 is not available.
-        unsigned short* from = (unsigned short*)s;
-        byte* to = d[0];
+    }
 
-        for(int i = 0; i < n; ++i)
+    SIMD_TARGET("avx2") void unpack_rw10_from_rw8_avx2(byte * const d[], const byte * s, int n)
+    {
+        auto src = reinterpret_cast<const uint16_t *>(s);
+        auto dst = d[0];
+
+        int i = 0;
+        for (; i + 32 <= n; i += 32)
         {
-          byte temp = (byte)(*from >> 2);
-          *to = temp;
-          ++from;
-          ++to;
+            __m256i out1_16 = _mm256_srli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i)), 2);
+            __m256i out2_16 = _mm256_srli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 16)), 2);
+            // packus works within 128-bit lanes, restore the qword order afterwards
+            __m256i out8 = _mm256_permute4x64_epi64(_mm256_packus_epi16(out1_16, out2_16), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), out8);
         }
-#endif
+
+        byte * const tail[] = { dst + i };
+        unpack_rw10_from_rw8(tail, s + i * 2, n - i);
     }
 
-    // Unpack luminocity 8 bit from 10-bit packed macro-pixels (4 pixels in 5 bytes):
-    // The first four bytes store the 8 MSB of each pixel, and the last byte holds the 2 LSB for each pixel :8888[2222]
-    void unpack_y8_from_rw10(byte *  const d[], const byte * s, int n)
+    SIMD_TARGET("avx512f,avx512bw") void unpack_rw10_from_rw8_avx512(byte * const d[], const byte * s, int n)
+    {
+        auto src = reinterpret_cast<const uint16_t *>(s);
+        auto dst = d[0];
+
+        int i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            __m512i out16 = _mm512_srli_epi16(_mm512_loadu_si512(src + i), 2);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm512_cvtusepi16_epi8(out16));
+        }
+
+        byte * const tail[] = { dst + i };
+        unpack_rw10_from_rw8(tail, s + i * 2, n - i);
+    }
+
+    SIMD_TARGET("ssse3") void unpack_y8_from_rw10_ssse3(byte * const d[], const byte * s, int n)
     {
-#ifdef __SSSE3__
-        assert(!(n % 48));  //We process 12 macro-pixels simultaneously to achieve performance boost
         auto src = reinterpret_cast<const uint8_t *>(s);
         auto dst = reinterpret_cast<uint8_t *>(d[0]);
 
@@ -186,8 +335,11 @@ namespace librealsense
         // The mask will reorder the input so the 12 bytes with pixels' MSB values will come first
         static const __m128i mask =_mm_setr_epi8(0x0, 0x1, 0x2, 0x3, 0x5, 0x6, 0x7, 0x8, 0xa, 0xb, 0xc, 0xd, -1, -1, -1, -1);
 
-
-        for (int i = 0; (i+48) < n; i += 48, src +=60, dst+=48)
+        // We process 12 macro-pixels simultaneously to achieve performance boost
+        // The last 16-byte store ends 4 bytes past the block's 48 output bytes, and the last load 1 byte past its 60 input bytes,
+        // so a block is only vectorized when 52 output pixels remain and the rest is left to the scalar code
+        int i = 0;
+        for (; i + 52 <= n; i += 48, src +=60, dst+=48)
         {
             blk_0_in = reinterpret_cast<const __m128i *>(src);
             blk_1_in = reinterpret_cast<const __m128i *>(src + 15);
@@ -209,19 +361,63 @@ namespace librealsense
             _mm_storeu_si128(blk_2_out, res[2]);
             _mm_storeu_si128(blk_3_out, res[3]);
         }
-#else  // Generic code for when SSSE3 is not available.
-        auto from = reinterpret_cast<const uint8_t *>(s);
-        uint8_t* tgt = d[0];
 
-        for (int i = 0; i < n; i+=4, from+=5)
+        byte * const tail[] = { dst };
+        unpack_y8_from_rw10(tail, src, n - i);
+    }
+
+    SIMD_TARGET("avx2") void unpack_y8_from_rw10_avx2(byte * const d[], const byte * s, int n)
+    {
+        auto src = reinterpret_cast<const uint8_t *>(s);
+        auto dst = reinterpret_cast<uint8_t *>(d[0]);
+
+        // Each lane gathers the MSB bytes of 3 macro-pixels, then the valid dwords of both lanes are packed together
+        const __m256i mask = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x0, 0x1, 0x2, 0x3, 0x5, 0x6, 0x7, 0x8, 0xa, 0xb, 0xc, 0xd, -1, -1, -1, -1));
+        const __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+        // The second 32-byte store ends 8 bytes past the block's 48 output bytes, so a block is only vectorized
+        // when 56 output pixels remain and the rest is left to the scalar code
+        int i = 0;
+        for (; i + 56 <= n; i += 48, src += 60, dst += 48)
         {
-            *tgt++ = from[0];
-            *tgt++ = from[1];
-            *tgt++ = from[2];
-            *tgt++ = from[3];
+            __m256i blk_01 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src))),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 15)), 1);
+            __m256i blk_23 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 30))),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 45)), 1);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(blk_01, mask), pack));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 24), _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(blk_23, mask), pack));
         }
-#endif
+
+        byte * const tail[] = { dst };
+        unpack_y8_from_rw10(tail, src, n - i);
+    }
+
+    SIMD_TARGET("avx512f,avx512bw,avx512vl") void unpack_y8_from_rw10_avx512(byte * const d[], const byte * s, int n)
+    {
+        auto src = reinterpret_cast<const uint8_t *>(s);
+        auto dst = reinterpret_cast<uint8_t *>(d[0]);
+
+        const __m512i mask = _mm512_broadcast_i32x4(_mm_setr_epi8(0x0, 0x1, 0x2, 0x3, 0x5, 0x6, 0x7, 0x8, 0xa, 0xb, 0xc, 0xd, -1, -1, -1, -1));
+
+        // Masked loads and stores touch exactly the 60 input and 48 output bytes, so no block needs the scalar fallback
+        int i = 0;
+        for (; (i+48) <= n; i += 48, src += 60, dst += 48)
+        {
+            __m512i blk = _mm512_castsi128_si512(_mm_maskz_loadu_epi8(0x7fff, src));
+            blk = _mm512_inserti32x4(blk, _mm_maskz_loadu_epi8(0x7fff, src + 15), 1);
+            blk = _mm512_inserti32x4(blk, _mm_maskz_loadu_epi8(0x7fff, src + 30), 2);
+            blk = _mm512_inserti32x4(blk, _mm_maskz_loadu_epi8(0x7fff, src + 45), 3);
+
+            // Keep the three valid dwords of each lane and store the 48 bytes at once
+            __m512i res = _mm512_maskz_compress_epi32(0x7777, _mm512_shuffle_epi8(blk, mask));
+            _mm512_mask_storeu_epi32(dst, 0x0fff, res);
+        }
+
+        byte * const tail[] = { dst };
+        unpack_y8_from_rw10(tail, src, n - i);
     }
+#endif
     /////////////////////////////
     // YUY2 unpacking routines //
     /////////////////////////////
@@ -231,7 +427,143 @@ namespace librealsense
     template<rs2_format FORMAT> void unpack_yuy2(byte * const d [], const byte * s, int n)
     {
         assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
-#ifdef __SSSE3__
+        auto src = reinterpret_cast<const uint8_t *>(s);
+        auto dst = reinterpret_cast<uint8_t *>(d[0]);
+        for(; n; n -= 16, src += 32)
+        {
+            if(FORMAT == RS2_FORMAT_Y8)
+            {
+                uint8_t out[16] = {
+                    src[ 0], src[ 2], src[ 4], src[ 6],
+                    src[ 8], src[10], src[12], src[14],
+                    src[16], src[18], src[20], src[22],
+                    src[24], src[26], src[28], src[30],
+                };
+                librealsense::copy(dst, out, sizeof out);
+                dst += sizeof out;
+                continue;
+            }
+
+            if(FORMAT == RS2_FORMAT_Y16)
+            {
+                // Y16 is little-endian.  We output Y << 8.
+                uint8_t out[32] = {
+                    0, src[ 0], 0, src[ 2], 0, src[ 4], 0, src[ 6],
+                    0, src[ 8], 0, src[10], 0, src[12], 0, src[14],
+                    0, src[16], 0, src[18], 0, src[20], 0, src[22],
+                    0, src[24], 0, src[26], 0, src[28], 0, src[30],
+                };
+                librealsense::copy(dst, out, sizeof out);
+                dst += sizeof out;
+                continue;
+            }
+
+            int16_t y[16] = {
+                src[ 0], src[ 2], src[ 4], src[ 6],
+                src[ 8], src[10], src[12], src[14],
+                src[16], src[18], src[20], src[22],
+                src[24], src[26], src[28], src[30],
+            }, u[16] = {
+                src[ 1], src[ 1], src[ 5], src[ 5],
+                src[ 9], src[ 9], src[13], src[13],
+                src[17], src[17], src[21], src[21],
+                src[25], src[25], src[29], src[29],
+            }, v[16] = {
+                src[ 3], src[ 3], src[ 7], src[ 7],
+                src[11], src[11], src[15], src[15],
+                src[19], src[19], src[23], src[23],
+                src[27], src[27], src[31], src[31],
+            };
+
+            uint8_t r[16], g[16], b[16];
+            for(int i = 0; i < 16; i++)
+            {
+                int32_t c = y[i] - 16;
+                int32_t d = u[i] - 128;
+                int32_t e = v[i] - 128;
+
+                int32_t t;
+                #define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
+                r[i] = clamp((298 * c           + 409 * e + 128) >> 8);
+                g[i] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
+                b[i] = clamp((298 * c + 516 * d           + 128) >> 8);
+                #undef clamp
+            }
+
+            if(FORMAT == RS2_FORMAT_RGB8)
+            {
+                uint8_t out[16*3] = {
+                    r[ 0], g[ 0], b[ 0], r[ 1], g[ 1], b[ 1],
+                    r[ 2], g[ 2], b[ 2], r[ 3], g[ 3], b[ 3],
+                    r[ 4], g[ 4], b[ 4], r[ 5], g[ 5], b[ 5],
+                    r[ 6], g[ 6], b[ 6], r[ 7], g[ 7], b[ 7],
+                    r[ 8], g[ 8], b[ 8], r[ 9], g[ 9], b[ 9],
+                    r[10], g[10], b[10], r[11], g[11], b[11],
+                    r[12], g[12], b[12], r[13], g[13], b[13],
+                    r[14], g[14], b[14], r[15], g[15], b[15],
+                };
+                librealsense::copy(dst, out, sizeof out);
+                dst += sizeof out;
+                continue;
+            }
+
+            if(FORMAT == RS2_FORMAT_BGR8)
+            {
+                uint8_t out[16*3] = {
+                    b[ 0], g[ 0], r[ 0], b[ 1], g[ 1], r[ 1],
+                    b[ 2], g[ 2], r[ 2], b[ 3], g[ 3], r[ 3],
+                    b[ 4], g[ 4], r[ 4], b[ 5], g[ 5], r[ 5],
+                    b[ 6], g[ 6], r[ 6], b[ 7], g[ 7], r[ 7],
+                    b[ 8], g[ 8], r[ 8], b[ 9], g[ 9], r[ 9],
+                    b[10], g[10], r[10], b[11], g[11], r[11],
+                    b[12], g[12], r[12], b[13], g[13], r[13],
+                    b[14], g[14], r[14], b[15], g[15], r[15],
+                };
+                librealsense::copy(dst, out, sizeof out);
+                dst += sizeof out;
+                continue;
+            }
+
+            if(FORMAT == RS2_FORMAT_RGBA8)
+            {
+                uint8_t out[16*4] = {
+                    r[ 0], g[ 0], b[ 0], 255, r[ 1], g[ 1], b[ 1], 255,
+                    r[ 2], g[ 2], b[ 2], 255, r[ 3], g[ 3], b[ 3], 255,
+                    r[ 4], g[ 4], b[ 4], 255, r[ 5], g[ 5], b[ 5], 255,
+                    r[ 6], g[ 6], b[ 6], 255, r[ 7], g[ 7], b[ 7], 255,
+                    r[ 8], g[ 8], b[ 8], 255, r[ 9], g[ 9], b[ 9], 255,
+                    r[10], g[10], b[10], 255, r[11], g[11], b[11], 255,
+                    r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
+                    r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
+                };
+                librealsense::copy(dst, out, sizeof out);
+                dst += sizeof out;
+                continue;
+            }
+
+            if(FORMAT == RS2_FORMAT_BGRA8)
+            {
+                uint8_t out[16*4] = {
+                    b[ 0], g[ 0], r[ 0], 255, b[ 1], g[ 1], r[ 1], 255,
+                    b[ 2], g[ 2], r[ 2], 255, b[ 3], g[ 3], r[ 3], 255,
+                    b[ 4], g[ 4], r[ 4], 255, b[ 5], g[ 5], r[ 5], 255,
+                    b[ 6], g[ 6], r[ 6], 255, b[ 7], g[ 7], r[ 7], 255,
+                    b[ 8], g[ 8], r[ 8], 255, b[ 9], g[ 9], r[ 9], 255,
+                    b[10], g[10], r[10], 255, b[11], g[11], r[11], 255,
+                    b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
+                    b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
+                };
+                librealsense::copy(dst, out, sizeof out);
+                dst += sizeof out;
+                continue;
+            }
+        }
+    }
+
+#ifdef RS2_SIMD_DISPATCH
+    template<rs2_format FORMAT> SIMD_TARGET("ssse3") void unpack_yuy2_ssse3(byte * const d[], const byte * s, int n)
+    {
+        assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
         auto src = reinterpret_cast<const __m128i *>(s);
         auto dst = reinterpret_cast<__m128i *>(d[0]);
         #pragma omp parallel for
@@ -254,7 +586,7 @@ namespace librealsense
                 // Align all Y components and output 16 pixels (16 bytes) at once
                 __m128i y0 = _mm_shuffle_epi8(s0, _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15,   0, 2, 4, 6, 8, 10, 12, 14));
                 __m128i y1 = _mm_shuffle_epi8(s1, _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14,   1, 3, 5, 7, 9, 11, 13, 15));
-                _mm_storeu_si128(&dst[i], _mm_alignr_epi8(y0, y1, 8));
+                _mm_storeu_si128(&dst[i], _mm_alignr_epi8(y1, y0, 8));
                 continue;
             }
 
@@ -374,57 +706,37 @@ namespace librealsense
                 }
             }
         }
-#else  // Generic code for when SSSE3 is not available.
+    }
+#endif
+
+    // This templated function unpacks UYVY into RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
+    // It is expected that all branching outside of the loop control variable will be removed due to constant-folding.
+    template<rs2_format FORMAT> void unpack_uyvy(byte * const d[], const byte * s, int n)
+    {
+        assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
         auto src = reinterpret_cast<const uint8_t *>(s);
         auto dst = reinterpret_cast<uint8_t *>(d[0]);
-        for(; n; n -= 16, src += 32)
+        for (; n; n -= 16, src += 32)
         {
-            if(FORMAT == RS2_FORMAT_Y8)
-            {
-                uint8_t out[16] = {
-                    src[ 0], src[ 2], src[ 4], src[ 6],
-                    src[ 8], src[10], src[12], src[14],
-                    src[16], src[18], src[20], src[22],
-                    src[24], src[26], src[28], src[30],
-                };
-                librealsense::copy(dst, out, sizeof out);
-                dst += sizeof out;
-                continue;
-            }
-
-            if(FORMAT == RS2_FORMAT_Y16)
-            {
-                // Y16 is little-endian.  We output Y << 8.
-                uint8_t out[32] = {
-                    0, src[ 0], 0, src[ 2], 0, src[ 4], 0, src[ 6],
-                    0, src[ 8], 0, src[10], 0, src[12], 0, src[14],
-                    0, src[16], 0, src[18], 0, src[20], 0, src[22],
-                    0, src[24], 0, src[26], 0, src[28], 0, src[30],
-                };
-                librealsense::copy(dst, out, sizeof out);
-                dst += sizeof out;
-                continue;
-            }
-
             int16_t y[16] = {
-                src[ 0], src[ 2], src[ 4], src[ 6],
-                src[ 8], src[10], src[12], src[14],
-                src[16], src[18], src[20], src[22],
-                src[24], src[26], src[28], src[30],
+                src[1], src[3], src[5], src[7],
+                src[9], src[11], src[13], src[15],
+                src[17], src[19], src[21], src[23],
+                src[25], src[27], src[29], src[31],
             }, u[16] = {
-                src[ 1], src[ 1], src[ 5], src[ 5],
-                src[ 9], src[ 9], src[13], src[13],
-                src[17], src[17], src[21], src[21],
-                src[25], src[25], src[29], src[29],
+                src[0], src[0], src[4], src[4],
+                src[8], src[8], src[12], src[12],
+                src[16], src[16], src[20], src[20],
+                src[24], src[24], src[28], src[28],
             }, v[16] = {
-                src[ 3], src[ 3], src[ 7], src[ 7],
-                src[11], src[11], src[15], src[15],
-                src[19], src[19], src[23], src[23],
-                src[27], src[27], src[31], src[31],
+                src[2], src[2], src[6], src[6],
+                src[10], src[10], src[14], src[14],
+                src[18], src[18], src[22], src[22],
+                src[26], src[26], src[30], src[30],
             };
 
             uint8_t r[16], g[16], b[16];
-            for(int i = 0; i < 16; i++)
+            for (int i = 0; i < 16; i++)
             {
                 int32_t c = y[i] - 16;
                 int32_t d = u[i] - 128;
@@ -432,20 +744,20 @@ namespace librealsense
 
                 int32_t t;
                 #define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
-                r[i] = clamp((298 * c           + 409 * e + 128) >> 8);
-                g[i] = clamp((298 * c - 100 * d - 409 * e + 128) >> 8);
-                b[i] = clamp((298 * c + 516 * d           + 128) >> 8);
+                r[i] = clamp((298 * c + 409 * e + 128) >> 8);
+                g[i] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
+                b[i] = clamp((298 * c + 516 * d + 128) >> 8);
                 #undef clamp
             }
 
-            if(FORMAT == RS2_FORMAT_RGB8)
+            if (FORMAT == RS2_FORMAT_RGB8)
             {
-                uint8_t out[16*3] = {
-                    r[ 0], g[ 0], b[ 0], r[ 1], g[ 1], b[ 1],
-                    r[ 2], g[ 2], b[ 2], r[ 3], g[ 3], b[ 3],
-                    r[ 4], g[ 4], b[ 4], r[ 5], g[ 5], b[ 5],
-                    r[ 6], g[ 6], b[ 6], r[ 7], g[ 7], b[ 7],
-                    r[ 8], g[ 8], b[ 8], r[ 9], g[ 9], b[ 9],
+                uint8_t out[16 * 3] = {
+                    r[0], g[0], b[0], r[1], g[1], b[1],
+                    r[2], g[2], b[2], r[3], g[3], b[3],
+                    r[4], g[4], b[4], r[5], g[5], b[5],
+                    r[6], g[6], b[6], r[7], g[7], b[7],
+                    r[8], g[8], b[8], r[9], g[9], b[9],
                     r[10], g[10], b[10], r[11], g[11], b[11],
                     r[12], g[12], b[12], r[13], g[13], b[13],
                     r[14], g[14], b[14], r[15], g[15], b[15],
@@ -455,14 +767,14 @@ namespace librealsense
                 continue;
             }
 
-            if(FORMAT == RS2_FORMAT_BGR8)
+            if (FORMAT == RS2_FORMAT_BGR8)
             {
-                uint8_t out[16*3] = {
-                    b[ 0], g[ 0], r[ 0], b[ 1], g[ 1], r[ 1],
-                    b[ 2], g[ 2], r[ 2], b[ 3], g[ 3], r[ 3],
-                    b[ 4], g[ 4], r[ 4], b[ 5], g[ 5], r[ 5],
-                    b[ 6], g[ 6], r[ 6], b[ 7], g[ 7], r[ 7],
-                    b[ 8], g[ 8], r[ 8], b[ 9], g[ 9], r[ 9],
+                uint8_t out[16 * 3] = {
+                    b[0], g[0], r[0], b[1], g[1], r[1],
+                    b[2], g[2], r[2], b[3], g[3], r[3],
+                    b[4], g[4], r[4], b[5], g[5], r[5],
+                    b[6], g[6], r[6], b[7], g[7], r[7],
+                    b[8], g[8], r[8], b[9], g[9], r[9],
                     b[10], g[10], r[10], b[11], g[11], r[11],
                     b[12], g[12], r[12], b[13], g[13], r[13],
                     b[14], g[14], r[14], b[15], g[15], r[15],
@@ -472,14 +784,14 @@ namespace librealsense
                 continue;
             }
 
-            if(FORMAT == RS2_FORMAT_RGBA8)
+            if (FORMAT == RS2_FORMAT_RGBA8)
             {
-                uint8_t out[16*4] = {
-                    r[ 0], g[ 0], b[ 0], 255, r[ 1], g[ 1], b[ 1], 255,
-                    r[ 2], g[ 2], b[ 2], 255, r[ 3], g[ 3], b[ 3], 255,
-                    r[ 4], g[ 4], b[ 4], 255, r[ 5], g[ 5], b[ 5], 255,
-                    r[ 6], g[ 6], b[ 6], 255, r[ 7], g[ 7], b[ 7], 255,
-                    r[ 8], g[ 8], b[ 8], 255, r[ 9], g[ 9], b[ 9], 255,
+                uint8_t out[16 * 4] = {
+                    r[0], g[0], b[0], 255, r[1], g[1], b[1], 255,
+                    r[2], g[2], b[2], 255, r[3], g[3], b[3], 255,
+                    r[4], g[4], b[4], 255, r[5], g[5], b[5], 255,
+                    r[6], g[6], b[6], 255, r[7], g[7], b[7], 255,
+                    r[8], g[8], b[8], 255, r[9], g[9], b[9], 255,
                     r[10], g[10], b[10], 255, r[11], g[11], b[11], 255,
                     r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
                     r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
@@ -489,14 +801,14 @@ namespace librealsense
                 continue;
             }
 
-            if(FORMAT == RS2_FORMAT_BGRA8)
+            if (FORMAT == RS2_FORMAT_BGRA8)
             {
-                uint8_t out[16*4] = {
-                    b[ 0], g[ 0], r[ 0], 255, b[ 1], g[ 1], r[ 1], 255,
-                    b[ 2], g[ 2], r[ 2], 255, b[ 3], g[ 3], r[ 3], 255,
-                    b[ 4], g[ 4], r[ 4], 255, b[ 5], g[ 5], r[ 5], 255,
-                    b[ 6], g[ 6], r[ 6], 255, b[ 7], g[ 7], r[ 7], 255,
-                    b[ 8], g[ 8], r[ 8], 255, b[ 9], g[ 9], r[ 9], 255,
+                uint8_t out[16 * 4] = {
+                    b[0], g[0], r[0], 255, b[1], g[1], r[1], 255,
+                    b[2], g[2], r[2], 255, b[3], g[3], r[3], 255,
+                    b[4], g[4], r[4], 255, b[5], g[5], r[5], 255,
+                    b[6], g[6], r[6], 255, b[7], g[7], r[7], 255,
+                    b[8], g[8], r[8], 255, b[9], g[9], r[9], 255,
                     b[10], g[10], r[10], 255, b[11], g[11], r[11], 255,
                     b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
                     b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
@@ -506,15 +818,12 @@ namespace librealsense
                 continue;
             }
         }
-#endif
     }
 
-    // This templated function unpacks UYVY into RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
-    // It is expected that all branching outside of the loop control variable will be removed due to constant-folding.
-    template<rs2_format FORMAT> void unpack_uyvy(byte * const d[], const byte * s, int n)
+#ifdef RS2_SIMD_DISPATCH
+    template<rs2_format FORMAT> SIMD_TARGET("ssse3") void unpack_uyvy_ssse3(byte * const d[], const byte * s, int n)
     {
         assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
-#ifdef __SSSE3__
         auto src = reinterpret_cast<const __m128i *>(s);
         auto dst = reinterpret_cast<__m128i *>(d[0]);
         for (; n; n -= 16)
@@ -641,114 +950,539 @@ namespace librealsense
                 }
             }
         }
-#else  // Generic code for when SSSE3 is not available.
-        auto src = reinterpret_cast<const uint8_t *>(s);
-        auto dst = reinterpret_cast<uint8_t *>(d[0]);
-        for (; n; n -= 16, src += 32)
+    }
+#endif
+
+#ifdef RS2_SIMD_DISPATCH
+    // The AVX2 and AVX-512 versions of unpack_yuy2_ssse3/unpack_uyvy_ssse3 run the exact same arithmetic in every 128-bit lane,
+    // each lane on its own group of 16 pixels, so their output is bit-exact with the SSSE3 routines.
+    template<rs2_format FORMAT> struct yuv422_output
+    {
+        // Number of 16-byte output registers per 16 pixels
+        static const int registers = FORMAT == RS2_FORMAT_Y8 ? 1 : FORMAT == RS2_FORMAT_Y16 ? 2 :
+                                     (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_BGR8) ? 3 : 4;
+    };
+
+    SIMD_TARGET("avx2") static inline __m256i clamp_to_byte_avx2(__m256i x)
+    {
+        return _mm256_min_epi16(_mm256_set1_epi16(255), _mm256_max_epi16(_mm256_setzero_si256(), x));
+    }
+
+    // Interleave 16-bit planes A, B, C (first and second 8 pixels of every lane) into ABCA or ABC pixels
+    template<bool ALPHA> SIMD_TARGET("avx2") static inline void interleave_pixels_avx2(__m256i a16__0_7, __m256i b16__0_7, __m256i c16__0_7,
+                                                                                       __m256i a16__8_F, __m256i b16__8_F, __m256i c16__8_F, __m256i out[])
+    {
+        const __m256i evens_odds = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+        const __m256i alpha = _mm256_set1_epi8(-1);
+
+        __m256i ab8__0_7 = _mm256_unpacklo_epi8(_mm256_shuffle_epi8(a16__0_7, evens_odds), _mm256_shuffle_epi8(b16__0_7, evens_odds));
+        __m256i ca8__0_7 = _mm256_unpacklo_epi8(_mm256_shuffle_epi8(c16__0_7, evens_odds), alpha);
+        __m256i ab8__8_F = _mm256_unpacklo_epi8(_mm256_shuffle_epi8(a16__8_F, evens_odds), _mm256_shuffle_epi8(b16__8_F, evens_odds));
+        __m256i ca8__8_F = _mm256_unpacklo_epi8(_mm256_shuffle_epi8(c16__8_F, evens_odds), alpha);
+
+        __m256i abca_0_3 = _mm256_unpacklo_epi16(ab8__0_7, ca8__0_7);
+        __m256i abca_4_7 = _mm256_unpackhi_epi16(ab8__0_7, ca8__0_7);
+        __m256i abca_8_B = _mm256_unpacklo_epi16(ab8__8_F, ca8__8_F);
+        __m256i abca_C_F = _mm256_unpackhi_epi16(ab8__8_F, ca8__8_F);
+
+        if (ALPHA)
         {
-            int16_t y[16] = {
-                src[1], src[3], src[5], src[7],
-                src[9], src[11], src[13], src[15],
-                src[17], src[19], src[21], src[23],
-                src[25], src[27], src[29], src[31],
-            }, u[16] = {
-                src[0], src[0], src[4], src[4],
-                src[8], src[8], src[12], src[12],
-                src[16], src[16], src[20], src[20],
-                src[24], src[24], src[28], src[28],
-            }, v[16] = {
-                src[2], src[2], src[6], src[6],
-                src[10], src[10], src[14], src[14],
-                src[18], src[18], src[22], src[22],
-                src[26], src[26], src[30], src[30],
-            };
+            out[0] = abca_0_3;
+            out[1] = abca_4_7;
+            out[2] = abca_8_B;
+            out[3] = abca_C_F;
+            return;
+        }
 
-            uint8_t r[16], g[16], b[16];
-            for (int i = 0; i < 16; i++)
+        // Shuffle the triples to the start and end of each register and align them
+        __m256i abc0 = _mm256_shuffle_epi8(abca_0_3, _mm256_broadcastsi128_si256(_mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14)));
+        __m256i abc1 = _mm256_shuffle_epi8(abca_4_7, _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14)));
+        __m256i abc2 = _mm256_shuffle_epi8(abca_8_B, _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14)));
+        __m256i abc3 = _mm256_shuffle_epi8(abca_C_F, _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15)));
+        out[0] = _mm256_alignr_epi8(abc1, abc0, 4);
+        out[1] = _mm256_alignr_epi8(abc2, abc1, 8);
+        out[2] = _mm256_alignr_epi8(abc3, abc2, 12);
+    }
+
+    template<rs2_format FORMAT, bool UYVY> SIMD_TARGET("avx2") void unpack_yuv422_avx2(byte * const d[], const byte * s, int n)
+    {
+        assert(n % 16 == 0);
+        const int regs = yuv422_output<FORMAT>::registers;
+        auto src = reinterpret_cast<const __m256i *>(s);
+        auto dst = reinterpret_cast<__m128i *>(d[0]);
+
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i n100 = _mm256_set1_epi16(100 << 4);
+        const __m256i n208 = _mm256_set1_epi16(208 << 4);
+        const __m256i n298 = _mm256_set1_epi16(298 << 4);
+        const __m256i n409 = _mm256_set1_epi16(409 << 4);
+        const __m256i n516 = _mm256_set1_epi16(516 << 4);
+        // Shuffle all Y components to the low order bytes of each lane, and all U/V components to the high order bytes
+        const __m256i yyyyyyyyuuuuvvvv = UYVY ? _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 4, 8, 12, 2, 6, 10, 14))
+                                              : _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15));
+
+        int i = 0;
+        for (; i + 32 <= n; i += 32, src += 2, dst += 2 * regs)
+        {
+            // Load two groups of 16 pixels, so that lane 0 of s0/s1 holds the first group and lane 1 the second
+            __m256i a = _mm256_loadu_si256(src);
+            __m256i b = _mm256_loadu_si256(src + 1);
+            __m256i s0 = _mm256_permute2x128_si256(a, b, 0x20);
+            __m256i s1 = _mm256_permute2x128_si256(a, b, 0x31);
+
+            __m256i yuv0 = _mm256_shuffle_epi8(s0, yyyyyyyyuuuuvvvv);
+            __m256i yuv8 = _mm256_shuffle_epi8(s1, yyyyyyyyuuuuvvvv);
+
+            __m256i out[4];
+            if (FORMAT == RS2_FORMAT_Y8)
             {
-                int32_t c = y[i] - 16;
-                int32_t d = u[i] - 128;
-                int32_t e = v[i] - 128;
+                out[0] = _mm256_unpacklo_epi64(yuv0, yuv8);
+            }
+            else if (FORMAT == RS2_FORMAT_Y16)
+            {
+                out[0] = _mm256_slli_epi16(_mm256_unpacklo_epi8(yuv0, zero), 8);
+                out[1] = _mm256_slli_epi16(_mm256_unpacklo_epi8(yuv8, zero), 8);
+            }
+            else
+            {
+                __m256i y16__0_7 = _mm256_unpacklo_epi8(yuv0, zero);
+                __m256i y16__8_F = _mm256_unpacklo_epi8(yuv8, zero);
+
+                __m256i uv = _mm256_unpackhi_epi32(yuv0, yuv8); // uuuuuuuuvvvvvvvv
+                __m256i u = _mm256_unpacklo_epi8(uv, uv);
+                __m256i v = _mm256_unpackhi_epi8(uv, uv);
+
+                __m256i c16__0_7 = _mm256_slli_epi16(_mm256_subs_epi16(y16__0_7, _mm256_set1_epi16(16)), 4);
+                __m256i d16__0_7 = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpacklo_epi8(u, zero), _mm256_set1_epi16(128)), 4);
+                __m256i e16__0_7 = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpacklo_epi8(v, zero), _mm256_set1_epi16(128)), 4);
+                __m256i r16__0_7 = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__0_7, n298), _mm256_mulhi_epi16(e16__0_7, n409)));
+                __m256i g16__0_7 = clamp_to_byte_avx2(_mm256_sub_epi16(_mm256_sub_epi16(_mm256_mulhi_epi16(c16__0_7, n298), _mm256_mulhi_epi16(d16__0_7, n100)), _mm256_mulhi_epi16(e16__0_7, n208)));
+                __m256i b16__0_7 = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__0_7, n298), _mm256_mulhi_epi16(d16__0_7, n516)));
+
+                __m256i c16__8_F = _mm256_slli_epi16(_mm256_subs_epi16(y16__8_F, _mm256_set1_epi16(16)), 4);
+                __m256i d16__8_F = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpackhi_epi8(u, zero), _mm256_set1_epi16(128)), 4);
+                __m256i e16__8_F = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpackhi_epi8(v, zero), _mm256_set1_epi16(128)), 4);
+                __m256i r16__8_F = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__8_F, n298), _mm256_mulhi_epi16(e16__8_F, n409)));
+                __m256i g16__8_F = clamp_to_byte_avx2(_mm256_sub_epi16(_mm256_sub_epi16(_mm256_mulhi_epi16(c16__8_F, n298), _mm256_mulhi_epi16(d16__8_F, n100)), _mm256_mulhi_epi16(e16__8_F, n208)));
+                __m256i b16__8_F = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__8_F, n298), _mm256_mulhi_epi16(d16__8_F, n516)));
+
+                if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8)
+                    interleave_pixels_avx2<FORMAT == RS2_FORMAT_RGBA8>(r16__0_7, g16__0_7, b16__0_7, r16__8_F, g16__8_F, b16__8_F, out);
+                else
+                    interleave_pixels_avx2<FORMAT == RS2_FORMAT_BGRA8>(b16__0_7, g16__0_7, r16__0_7, b16__8_F, g16__8_F, r16__8_F, out);
+            }
 
-                int32_t t;
-                #define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
-                r[i] = clamp((298 * c + 409 * e + 128) >> 8);
-                g[i] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-                b[i] = clamp((298 * c + 516 * d + 128) >> 8);
-                #undef clamp
+            // Store the first group of 16 pixels, followed by the second
+            for (int k = 0; k < regs; ++k)
+            {
+                _mm_storeu_si128(dst + k, _mm256_castsi256_si128(out[k]));
+                _mm_storeu_si128(dst + regs + k, _mm256_extracti128_si256(out[k], 1));
             }
+        }
 
-            if (FORMAT == RS2_FORMAT_RGB8)
+        // An odd group of 16 pixels is left to the SSSE3 routine
+        if (i < n)
+        {
+            byte * const tail[] = { reinterpret_cast<byte *>(dst) };
+            if (UYVY) unpack_uyvy_ssse3<FORMAT>(tail, s + i * 2, n - i);
+            else      unpack_yuy2_ssse3<FORMAT>(tail, s + i * 2, n - i);
+        }
+    }
+
+    SIMD_TARGET("avx512f,avx512bw") static inline __m512i clamp_to_byte_avx512(__m512i x)
+    {
+        return _mm512_min_epi16(_mm512_set1_epi16(255), _mm512_max_epi16(_mm512_setzero_si512(), x));
+    }
+
+    // Same as interleave_pixels_avx2, on four lanes
+    template<bool ALPHA> SIMD_TARGET("avx512f,avx512bw") static inline void interleave_pixels_avx512(__m512i a16__0_7, __m512i b16__0_7, __m512i c16__0_7,
+                                                                                                     __m512i a16__8_F, __m512i b16__8_F, __m512i c16__8_F, __m512i out[])
+    {
+        const __m512i evens_odds = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+        const __m512i alpha = _mm512_set1_epi8(-1);
+
+        __m512i ab8__0_7 = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(a16__0_7, evens_odds), _mm512_shuffle_epi8(b16__0_7, evens_odds));
+        __m512i ca8__0_7 = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(c16__0_7, evens_odds), alpha);
+        __m512i ab8__8_F = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(a16__8_F, evens_odds), _mm512_shuffle_epi8(b16__8_F, evens_odds));
+        __m512i ca8__8_F = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(c16__8_F, evens_odds), alpha);
+
+        __m512i abca_0_3 = _mm512_unpacklo_epi16(ab8__0_7, ca8__0_7);
+        __m512i abca_4_7 = _mm512_unpackhi_epi16(ab8__0_7, ca8__0_7);
+        __m512i abca_8_B = _mm512_unpacklo_epi16(ab8__8_F, ca8__8_F);
+        __m512i abca_C_F = _mm512_unpackhi_epi16(ab8__8_F, ca8__8_F);
+
+        if (ALPHA)
+        {
+            out[0] = abca_0_3;
+            out[1] = abca_4_7;
+            out[2] = abca_8_B;
+            out[3] = abca_C_F;
+            return;
+        }
+
+        // Shuffle the triples to the start and end of each register and align them
+        __m512i abc0 = _mm512_shuffle_epi8(abca_0_3, _mm512_broadcast_i32x4(_mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14)));
+        __m512i abc1 = _mm512_shuffle_epi8(abca_4_7, _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14)));
+        __m512i abc2 = _mm512_shuffle_epi8(abca_8_B, _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14)));
+        __m512i abc3 = _mm512_shuffle_epi8(abca_C_F, _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15)));
+        out[0] = _mm512_alignr_epi8(abc1, abc0, 4);
+        out[1] = _mm512_alignr_epi8(abc2, abc1, 8);
+        out[2] = _mm512_alignr_epi8(abc3, abc2, 12);
+    }
+
+    template<rs2_format FORMAT, bool UYVY> SIMD_TARGET("avx512f,avx512bw") void unpack_yuv422_avx512(byte * const d[], const byte * s, int n)
+    {
+        assert(n % 16 == 0);
+        const int regs = yuv422_output<FORMAT>::registers;
+        auto src = reinterpret_cast<const __m512i *>(s);
+        auto dst = reinterpret_cast<__m128i *>(d[0]);
+
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i n100 = _mm512_set1_epi16(100 << 4);
+        const __m512i n208 = _mm512_set1_epi16(208 << 4);
+        const __m512i n298 = _mm512_set1_epi16(298 << 4);
+        const __m512i n409 = _mm512_set1_epi16(409 << 4);
+        const __m512i n516 = _mm512_set1_epi16(516 << 4);
+        // Shuffle all Y components to the low order bytes of each lane, and all U/V components to the high order bytes
+        const __m512i yyyyyyyyuuuuvvvv = UYVY ? _mm512_broadcast_i32x4(_mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 4, 8, 12, 2, 6, 10, 14))
+                                              : _mm512_broadcast_i32x4(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15));
+
+        int i = 0;
+        for (; i + 64 <= n; i += 64, src += 2, dst += 4 * regs)
+        {
+            // Load four groups of 16 pixels, so that lane k of s0/s1 holds group k
+            __m512i a = _mm512_loadu_si512(src);
+            __m512i b = _mm512_loadu_si512(src + 1);
+            __m512i s0 = _mm512_shuffle_i64x2(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m512i s1 = _mm512_shuffle_i64x2(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+            __m512i yuv0 = _mm512_shuffle_epi8(s0, yyyyyyyyuuuuvvvv);
+            __m512i yuv8 = _mm512_shuffle_epi8(s1, yyyyyyyyuuuuvvvv);
+
+            __m512i out[4];
+            if (FORMAT == RS2_FORMAT_Y8)
             {
-                uint8_t out[16 * 3] = {
-                    r[0], g[0], b[0], r[1], g[1], b[1],
-                    r[2], g[2], b[2], r[3], g[3], b[3],
-                    r[4], g[4], b[4], r[5], g[5], b[5],
-                    r[6], g[6], b[6], r[7], g[7], b[7],
-                    r[8], g[8], b[8], r[9], g[9], b[9],
-                    r[10], g[10], b[10], r[11], g[11], b[11],
-                    r[12], g[12], b[12], r[13], g[13], b[13],
-                    r[14], g[14], b[14], r[15], g[15], b[15],
-                };
-                librealsense::copy(dst, out, sizeof out);
-                dst += sizeof out;
-                continue;
+                out[0] = _mm512_unpacklo_epi64(yuv0, yuv8);
+            }
+            else if (FORMAT == RS2_FORMAT_Y16)
+            {
+                out[0] = _mm512_slli_epi16(_mm512_unpacklo_epi8(yuv0, zero), 8);
+                out[1] = _mm512_slli_epi16(_mm512_unpacklo_epi8(yuv8, zero), 8);
+            }
+            else
+            {
+                __m512i y16__0_7 = _mm512_unpacklo_epi8(yuv0, zero);
+                __m512i y16__8_F = _mm512_unpacklo_epi8(yuv8, zero);
+
+                __m512i uv = _mm512_unpackhi_epi32(yuv0, yuv8); // uuuuuuuuvvvvvvvv
+                __m512i u = _mm512_unpacklo_epi8(uv, uv);
+                __m512i v = _mm512_unpackhi_epi8(uv, uv);
+
+                __m512i c16__0_7 = _mm512_slli_epi16(_mm512_subs_epi16(y16__0_7, _mm512_set1_epi16(16)), 4);
+                __m512i d16__0_7 = _mm512_slli_epi16(_mm512_subs_epi16(_mm512_unpacklo_epi8(u, zero), _mm512_set1_epi16(128)), 4);
+                __m512i e16__0_7 = _mm512_slli_epi16(_mm512_subs_epi16(_mm512_unpacklo_epi8(v, zero), _mm512_set1_epi16(128)), 4);
+                __m512i r16__0_7 = clamp_to_byte_avx512(_mm512_add_epi16(_mm512_mulhi_epi16(c16__0_7, n298), _mm512_mulhi_epi16(e16__0_7, n409)));
+                __m512i g16__0_7 = clamp_to_byte_avx512(_mm512_sub_epi16(_mm512_sub_epi16(_mm512_mulhi_epi16(c16__0_7, n298), _mm512_mulhi_epi16(d16__0_7, n100)), _mm512_mulhi_epi16(e16__0_7, n208)));
+                __m512i b16__0_7 = clamp_to_byte_avx512(_mm512_add_epi16(_mm512_mulhi_epi16(c16__0_7, n298), _mm512_mulhi_epi16(d16__0_7, n516)));
+
+                __m512i c16__8_F = _mm512_slli_epi16(_mm512_subs_epi16(y16__8_F, _mm512_set1_epi16(16)), 4);
+                __m512i d16__8_F = _mm512_slli_epi16(_mm512_subs_epi16(_mm512_unpackhi_epi8(u, zero), _mm512_set1_epi16(128)), 4);
+                __m512i e16__8_F = _mm512_slli_epi16(_mm512_subs_epi16(_mm512_unpackhi_epi8(v, zero), _mm512_set1_epi16(128)), 4);
+                __m512i r16__8_F = clamp_to_byte_avx512(_mm512_add_epi16(_mm512_mulhi_epi16(c16__8_F, n298), _mm512_mulhi_epi16(e16__8_F, n409)));
+                __m512i g16__8_F = clamp_to_byte_avx512(_mm512_sub_epi16(_mm512_sub_epi16(_mm512_mulhi_epi16(c16__8_F, n298), _mm512_mulhi_epi16(d16__8_F, n100)), _mm512_mulhi_epi16(e16__8_F, n208)));
+                __m512i b16__8_F = clamp_to_byte_avx512(_mm512_add_epi16(_mm512_mulhi_epi16(c16__8_F, n298), _mm512_mulhi_epi16(d16__8_F, n516)));
+
+                if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8)
+                    interleave_pixels_avx512<FORMAT == RS2_FORMAT_RGBA8>(r16__0_7, g16__0_7, b16__0_7, r16__8_F, g16__8_F, b16__8_F, out);
+                else
+                    interleave_pixels_avx512<FORMAT == RS2_FORMAT_BGRA8>(b16__0_7, g16__0_7, r16__0_7, b16__8_F, g16__8_F, r16__8_F, out);
             }
 
-            if (FORMAT == RS2_FORMAT_BGR8)
+            // Store the groups of 16 pixels one after the other
+            for (int k = 0; k < regs; ++k)
             {
-                uint8_t out[16 * 3] = {
-                    b[0], g[0], r[0], b[1], g[1], r[1],
-                    b[2], g[2], r[2], b[3], g[3], r[3],
-                    b[4], g[4], r[4], b[5], g[5], r[5],
-                    b[6], g[6], r[6], b[7], g[7], r[7],
-                    b[8], g[8], r[8], b[9], g[9], r[9],
-                    b[10], g[10], r[10], b[11], g[11], r[11],
-                    b[12], g[12], r[12], b[13], g[13], r[13],
-                    b[14], g[14], r[14], b[15], g[15], r[15],
-                };
-                librealsense::copy(dst, out, sizeof out);
-                dst += sizeof out;
-                continue;
+                _mm_storeu_si128(dst + k, _mm512_castsi512_si128(out[k]));
+                _mm_storeu_si128(dst + regs + k, _mm512_extracti32x4_epi32(out[k], 1));
+                _mm_storeu_si128(dst + 2 * regs + k, _mm512_extracti32x4_epi32(out[k], 2));
+                _mm_storeu_si128(dst + 3 * regs + k, _mm512_extracti32x4_epi32(out[k], 3));
             }
+        }
 
-            if (FORMAT == RS2_FORMAT_RGBA8)
+        // The remaining 16 to 48 pixels are left to the AVX2 routine
+        if (i < n)
+        {
+            byte * const tail[] = { reinterpret_cast<byte *>(dst) };
+            unpack_yuv422_avx2<FORMAT, UYVY>(tail, s + i * 2, n - i);
+        }
+    }
+#endif
+
+    //////////////////////////////////////////
+    // YUY2 to 4:2:0 (NV12, I420) routines //
+    //////////////////////////////////////////
+
+    // Converts pixels [begin, width) of a pair of YUY2 rows. The chroma of the two rows is averaged into one row of the
+    // half-resolution chroma planes: interleaved in u for NV12, or split between u and v for I420
+    template<bool NV12> void unpack_420_rows_from_yuy2(uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v, const uint8_t * s0, const uint8_t * s1, int begin, int width)
+    {
+        for (int x = begin; x < width; x += 2)
+        {
+            y0[x] = s0[x * 2];
+            y0[x + 1] = s0[x * 2 + 2];
+            y1[x] = s1[x * 2];
+            y1[x + 1] = s1[x * 2 + 2];
+            auto cb = static_cast<uint8_t>((s0[x * 2 + 1] + s1[x * 2 + 1] + 1) / 2);
+            auto cr = static_cast<uint8_t>((s0[x * 2 + 3] + s1[x * 2 + 3] + 1) / 2);
+            if (NV12)
             {
-                uint8_t out[16 * 4] = {
-                    r[0], g[0], b[0], 255, r[1], g[1], b[1], 255,
-                    r[2], g[2], b[2], 255, r[3], g[3], b[3], 255,
-                    r[4], g[4], b[4], 255, r[5], g[5], b[5], 255,
-                    r[6], g[6], b[6], 255, r[7], g[7], b[7], 255,
-                    r[8], g[8], b[8], 255, r[9], g[9], b[9], 255,
-                    r[10], g[10], b[10], 255, r[11], g[11], b[11], 255,
-                    r[12], g[12], b[12], 255, r[13], g[13], b[13], 255,
-                    r[14], g[14], b[14], 255, r[15], g[15], b[15], 255,
-                };
-                librealsense::copy(dst, out, sizeof out);
-                dst += sizeof out;
-                continue;
+                u[x] = cb;
+                u[x + 1] = cr;
+            }
+            else
+            {
+                u[x / 2] = cb;
+                v[x / 2] = cr;
             }
+        }
+    }
 
-            if (FORMAT == RS2_FORMAT_BGRA8)
+    template<bool NV12> void unpack_420_rows_from_yuy2(uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v, const uint8_t * s0, const uint8_t * s1, int width)
+    {
+        unpack_420_rows_from_yuy2<NV12>(y0, y1, u, v, s0, s1, 0, width);
+    }
+
+    typedef void(*unpack_420_rows)(uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v, const uint8_t * s0, const uint8_t * s1, int width);
+
+    template<bool NV12, unpack_420_rows ROWS> void unpack_420_from_yuy2(byte * const dest[], const byte * source, int width, int height)
+    {
+        auto luma = reinterpret_cast<uint8_t *>(dest[0]);
+        auto u = luma + width * height;
+        auto v = u + width / 2 * height / 2;
+        auto chroma_stride = NV12 ? width : width / 2;
+        for (int row = 0; row < height; row += 2)
+        {
+            auto s0 = reinterpret_cast<const uint8_t *>(source) + row * width * 2;
+            auto y0 = luma + row * width;
+            ROWS(y0, y0 + width, u + row / 2 * chroma_stride, v + row / 2 * chroma_stride, s0, s0 + width * 2, width);
+        }
+    }
+
+#ifdef RS2_SIMD_DISPATCH
+    template<bool NV12> SIMD_TARGET("ssse3") void unpack_420_rows_from_yuy2_ssse3(uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v, const uint8_t * s0, const uint8_t * s1, int width)
+    {
+        const __m128i low_byte = _mm_set1_epi16(0xff);
+        const __m128i cb_cr = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+        int x = 0;
+        for (; x + 16 <= width; x += 16)
+        {
+            __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s0 + x * 2));
+            __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s0 + x * 2 + 16));
+            __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s1 + x * 2));
+            __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s1 + x * 2 + 16));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(y0 + x), _mm_packus_epi16(_mm_and_si128(a0, low_byte), _mm_and_si128(a1, low_byte)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(y1 + x), _mm_packus_epi16(_mm_and_si128(b0, low_byte), _mm_and_si128(b1, low_byte)));
+
+            // The chroma bytes of YUY2 already come in NV12 order, U0 V0 U1 V1 ...
+            __m128i c = _mm_avg_epu8(_mm_packus_epi16(_mm_srli_epi16(a0, 8), _mm_srli_epi16(a1, 8)),
+                                     _mm_packus_epi16(_mm_srli_epi16(b0, 8), _mm_srli_epi16(b1, 8)));
+            if (NV12)
             {
-                uint8_t out[16 * 4] = {
-                    b[0], g[0], r[0], 255, b[1], g[1], r[1], 255,
-                    b[2], g[2], r[2], 255, b[3], g[3], r[3], 255,
-                    b[4], g[4], r[4], 255, b[5], g[5], r[5], 255,
-                    b[6], g[6], r[6], 255, b[7], g[7], r[7], 255,
-                    b[8], g[8], r[8], 255, b[9], g[9], r[9], 255,
-                    b[10], g[10], r[10], 255, b[11], g[11], r[11], 255,
-                    b[12], g[12], r[12], 255, b[13], g[13], r[13], 255,
-                    b[14], g[14], r[14], 255, b[15], g[15], r[15], 255,
-                };
-                librealsense::copy(dst, out, sizeof out);
-                dst += sizeof out;
-                continue;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(u + x), c);
+            }
+            else
+            {
+                c = _mm_shuffle_epi8(c, cb_cr);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(u + x / 2), c);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(v + x / 2), _mm_unpackhi_epi64(c, c));
             }
         }
+        unpack_420_rows_from_yuy2<NV12>(y0, y1, u, v, s0, s1, x, width);
+    }
+
+    template<bool NV12> SIMD_TARGET("avx2") void unpack_420_rows_from_yuy2_avx2(uint8_t * y0, uint8_t * y1, uint8_t * u, uint8_t * v, const uint8_t * s0, const uint8_t * s1, int width)
+    {
+        const __m256i low_byte = _mm256_set1_epi16(0xff);
+        const __m256i cb_cr = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+
+        int x = 0;
+        for (; x + 32 <= width; x += 32)
+        {
+            __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s0 + x * 2));
+            __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s0 + x * 2 + 32));
+            __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s1 + x * 2));
+            __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s1 + x * 2 + 32));
+            // The packs work within lanes, leaving the groups of 8 pixels in 0, 2, 1, 3 order
+            __m256i l0 = _mm256_packus_epi16(_mm256_and_si256(a0, low_byte), _mm256_and_si256(a1, low_byte));
+            __m256i l1 = _mm256_packus_epi16(_mm256_and_si256(b0, low_byte), _mm256_and_si256(b1, low_byte));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(y0 + x), _mm256_permute4x64_epi64(l0, _MM_SHUFFLE(3, 1, 2, 0)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(y1 + x), _mm256_permute4x64_epi64(l1, _MM_SHUFFLE(3, 1, 2, 0)));
+
+            __m256i c = _mm256_avg_epu8(_mm256_packus_epi16(_mm256_srli_epi16(a0, 8), _mm256_srli_epi16(a1, 8)),
+                                        _mm256_packus_epi16(_mm256_srli_epi16(b0, 8), _mm256_srli_epi16(b1, 8)));
+            c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(3, 1, 2, 0));
+            if (NV12)
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(u + x), c);
+            }
+            else
+            {
+                c = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(c, cb_cr), _MM_SHUFFLE(3, 1, 2, 0));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(u + x / 2), _mm256_castsi256_si128(c));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(v + x / 2), _mm256_extracti128_si256(c, 1));
+            }
+        }
+        unpack_420_rows_from_yuy2<NV12>(y0, y1, u, v, s0, s1, x, width);
+    }
 #endif
+
+    ///////////////////////////////////////
+    // YUY2 decode and downscale routines //
+    ///////////////////////////////////////
+
+    template<rs2_format FORMAT> void store_rgb_from_yuv(uint8_t * dst, int y, int u, int v)
+    {
+        int32_t c = y - 16;
+        int32_t d = u - 128;
+        int32_t e = v - 128;
+
+        // min/max rather than a conditional, so that the clamp compiles to branch-free code
+        auto clamp = [](int32_t x) { return static_cast<uint8_t>(std::min(std::max(x, 0), 255)); };
+        uint8_t r = clamp((298 * c           + 409 * e + 128) >> 8);
+        uint8_t g = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
+        uint8_t b = clamp((298 * c + 516 * d           + 128) >> 8);
+
+        bool bgr = FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8;
+        dst[0] = bgr ? b : r;
+        dst[1] = g;
+        dst[2] = bgr ? r : b;
+        if (FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGRA8) dst[3] = 255;
+    }
+
+    // Converts pixels [begin, count) of a row of full-resolution Y, U and V planes
+    template<rs2_format FORMAT> void convert_yuv_row(uint8_t * dst, const uint8_t * y, const uint8_t * u, const uint8_t * v, int begin, int count)
+    {
+        const int bpp = FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_BGR8 ? 3 : 4;
+        for (int x = begin; x < count; ++x)
+            store_rgb_from_yuv<FORMAT>(dst + x * bpp, y[x], u[x], v[x]);
+    }
+
+    template<rs2_format FORMAT> void convert_yuv_row(uint8_t * dst, const uint8_t * y, const uint8_t * u, const uint8_t * v, int count)
+    {
+        convert_yuv_row<FORMAT>(dst, y, u, v, 0, count);
+    }
+
+    typedef void(*convert_yuv_row_function)(uint8_t * dst, const uint8_t * y, const uint8_t * u, const uint8_t * v, int count);
+
+    // Decodes YUY2 into RGB8/RGBA8/BGR8/BGRA8 at 1/SCALE of the resolution in both dimensions. The Y, U and V samples of each
+    // SCALE x SCALE block are averaged before the colour conversion, so only one pixel per block is converted, and the
+    // full-resolution image is never written
+    template<rs2_format FORMAT, int SCALE, convert_yuv_row_function CONVERT> void unpack_downscaled_from_yuy2(byte * const dest[], const byte * source, int width, int height)
+    {
+        const int bpp = FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_BGR8 ? 3 : 4;
+        const int area = SCALE * SCALE;
+        auto dst = reinterpret_cast<uint8_t *>(dest[0]);
+        auto out_width = width / SCALE;
+
+        // The block averages of a row are gathered into planar Y, U and V rows, which CONVERT turns into pixels
+        std::vector<uint16_t> sums(width * 2);
+        std::vector<uint8_t> planes(out_width * 3);
+        auto ys = planes.data(), us = ys + out_width, vs = us + out_width;
+        for (int row = 0; row + SCALE <= height; row += SCALE, dst += out_width * bpp)
+        {
+            // Sum the SCALE source rows byte by byte first, a plain loop the compiler vectorizes
+            auto src = reinterpret_cast<const uint8_t *>(source) + row * width * 2;
+            for (int i = 0; i < width * 2; ++i)
+                sums[i] = src[i];
+            for (int k = 1; k < SCALE; ++k)
+            {
+                auto line = src + k * width * 2;
+                for (int i = 0; i < width * 2; ++i)
+                    sums[i] += line[i];
+            }
+
+            for (int x = 0; x < out_width; ++x)
+            {
+                int y = 0, u = 0, v = 0;
+                for (int i = x * SCALE; i < x * SCALE + SCALE; ++i)
+                    y += sums[i * 2];
+                if (SCALE % 2 == 0)
+                {
+                    // Even blocks cover whole macropixels, each of whose chroma is shared by two pixels
+                    for (int m = x * SCALE / 2; m < (x + 1) * SCALE / 2; ++m)
+                    {
+                        u += 2 * sums[m * 4 + 1];
+                        v += 2 * sums[m * 4 + 3];
+                    }
+                }
+                else
+                {
+                    for (int i = x * SCALE; i < x * SCALE + SCALE; ++i)
+                    {
+                        u += sums[(i & ~1) * 2 + 1]; // pixels 2n and 2n+1 share the chroma of macropixel n
+                        v += sums[(i & ~1) * 2 + 3];
+                    }
+                }
+                ys[x] = static_cast<uint8_t>((y + area / 2) / area);
+                us[x] = static_cast<uint8_t>((u + area / 2) / area);
+                vs[x] = static_cast<uint8_t>((v + area / 2) / area);
+            }
+
+            CONVERT(dst, ys, us, vs, out_width);
+        }
     }
 
+#ifdef RS2_SIMD_DISPATCH
+    // Same arithmetic as unpack_yuv422_avx2, on 32 pixels that each carry their own chroma
+    template<rs2_format FORMAT> SIMD_TARGET("avx2") void convert_yuv_row_avx2(uint8_t * dst, const uint8_t * y, const uint8_t * u, const uint8_t * v, int count)
+    {
+        const int regs = yuv422_output<FORMAT>::registers;
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i n100 = _mm256_set1_epi16(100 << 4);
+        const __m256i n208 = _mm256_set1_epi16(208 << 4);
+        const __m256i n298 = _mm256_set1_epi16(298 << 4);
+        const __m256i n409 = _mm256_set1_epi16(409 << 4);
+        const __m256i n516 = _mm256_set1_epi16(516 << 4);
+        auto out = reinterpret_cast<__m128i *>(dst);
+
+        int x = 0;
+        for (; x + 32 <= count; x += 32, out += 2 * regs)
+        {
+            // Lane 0 holds pixels 0-15 and lane 1 pixels 16-31; the unpacks split each lane into its first and second 8 pixels
+            __m256i y8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y + x));
+            __m256i u8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(u + x));
+            __m256i v8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(v + x));
+
+            __m256i c16__0_7 = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpacklo_epi8(y8, zero), _mm256_set1_epi16(16)), 4);
+            __m256i d16__0_7 = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpacklo_epi8(u8, zero), _mm256_set1_epi16(128)), 4);
+            __m256i e16__0_7 = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpacklo_epi8(v8, zero), _mm256_set1_epi16(128)), 4);
+            __m256i r16__0_7 = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__0_7, n298), _mm256_mulhi_epi16(e16__0_7, n409)));
+            __m256i g16__0_7 = clamp_to_byte_avx2(_mm256_sub_epi16(_mm256_sub_epi16(_mm256_mulhi_epi16(c16__0_7, n298), _mm256_mulhi_epi16(d16__0_7, n100)), _mm256_mulhi_epi16(e16__0_7, n208)));
+            __m256i b16__0_7 = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__0_7, n298), _mm256_mulhi_epi16(d16__0_7, n516)));
+
+            __m256i c16__8_F = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpackhi_epi8(y8, zero), _mm256_set1_epi16(16)), 4);
+            __m256i d16__8_F = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpackhi_epi8(u8, zero), _mm256_set1_epi16(128)), 4);
+            __m256i e16__8_F = _mm256_slli_epi16(_mm256_subs_epi16(_mm256_unpackhi_epi8(v8, zero), _mm256_set1_epi16(128)), 4);
+            __m256i r16__8_F = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__8_F, n298), _mm256_mulhi_epi16(e16__8_F, n409)));
+            __m256i g16__8_F = clamp_to_byte_avx2(_mm256_sub_epi16(_mm256_sub_epi16(_mm256_mulhi_epi16(c16__8_F, n298), _mm256_mulhi_epi16(d16__8_F, n100)), _mm256_mulhi_epi16(e16__8_F, n208)));
+            __m256i b16__8_F = clamp_to_byte_avx2(_mm256_add_epi16(_mm256_mulhi_epi16(c16__8_F, n298), _mm256_mulhi_epi16(d16__8_F, n516)));
+
+            __m256i pixels[4];
+            if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8)
+                interleave_pixels_avx2<FORMAT == RS2_FORMAT_RGBA8>(r16__0_7, g16__0_7, b16__0_7, r16__8_F, g16__8_F, b16__8_F, pixels);
+            else
+                interleave_pixels_avx2<FORMAT == RS2_FORMAT_BGRA8>(b16__0_7, g16__0_7, r16__0_7, b16__8_F, g16__8_F, r16__8_F, pixels);
+
+            for (int k = 0; k < regs; ++k)
+            {
+                _mm_storeu_si128(out + k, _mm256_castsi256_si128(pixels[k]));
+                _mm_storeu_si128(out + regs + k, _mm256_extracti128_si256(pixels[k], 1));
+            }
+        }
+        convert_yuv_row<FORMAT>(dst, y, u, v, x, count);
+    }
+#endif
+
     //////////////////////////////////////
     // 2-in-1 format splitting routines //
     //////////////////////////////////////
@@ -811,6 +1545,228 @@ namespace librealsense
         librealsense::copy(dest[0], in, count*2);
     }
 
+#ifdef RS2_SIMD_DISPATCH
+    // SIMD versions of the splitters above, bit-exact with the split_frame based reference. These are bound by memory
+    // bandwidth already at 256 bits, so AVX-512 CPUs use the AVX2 versions.
+    // The 3-byte formats are processed 8 pixels (24 bytes) per 128-bit lane, loaded as two overlapping registers:
+    // bytes 0-15 hold pixels 0-3 and bytes 8-23 hold pixels 4-7, so that no load reaches past the pixels being unpacked.
+
+    SIMD_TARGET("avx2") static inline void load_3_byte_pixels_avx2(const byte * src, __m256i & lo, __m256i & hi)
+    {
+        lo = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src))),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 24)), 1);
+        hi = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8))),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32)), 1);
+    }
+
+    // Shuffle masks gathering, for 8 pixels of 3 bytes, the 16-bit word starting at byte 0 or 1 of each pixel, or its byte 2
+    #define WORD_AT_0_LO   0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1
+    #define WORD_AT_0_HI   -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 7, 8, 10, 11, 13, 14
+    #define WORD_AT_1_LO   1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1
+    #define WORD_AT_1_HI   -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 8, 9, 11, 12, 14, 15
+    #define BYTE_AT_2_LO   2, 5, 8, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+    #define BYTE_AT_2_HI   -1, -1, -1, -1, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1
+
+    SIMD_TARGET("ssse3") void unpack_y8_y8_from_y8i_ssse3(byte * const dest[], const byte * source, int count)
+    {
+        auto src = reinterpret_cast<const __m128i *>(source);
+        auto a = reinterpret_cast<__m128i *>(dest[0]);
+        auto b = reinterpret_cast<__m128i *>(dest[1]);
+        const __m128i evens_odds = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+        int i = 0;
+        for (; i + 16 <= count; i += 16, src += 2)
+        {
+            __m128i lr0 = _mm_shuffle_epi8(_mm_loadu_si128(src), evens_odds);     // llllllllrrrrrrrr
+            __m128i lr8 = _mm_shuffle_epi8(_mm_loadu_si128(src + 1), evens_odds);
+            _mm_storeu_si128(a++, _mm_unpacklo_epi64(lr0, lr8));
+            _mm_storeu_si128(b++, _mm_unpackhi_epi64(lr0, lr8));
+        }
+
+        byte * const tail[] = { dest[0] + i, dest[1] + i };
+        unpack_y8_y8_from_y8i(tail, source + i * 2, count - i);
+    }
+
+    SIMD_TARGET("avx2") void unpack_y8_y8_from_y8i_avx2(byte * const dest[], const byte * source, int count)
+    {
+        auto src = reinterpret_cast<const __m256i *>(source);
+        auto a = reinterpret_cast<__m256i *>(dest[0]);
+        auto b = reinterpret_cast<__m256i *>(dest[1]);
+        const __m256i evens_odds = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+
+        int i = 0;
+        for (; i + 32 <= count; i += 32, src += 2)
+        {
+            __m256i lr0 = _mm256_shuffle_epi8(_mm256_loadu_si256(src), evens_odds);
+            __m256i lr16 = _mm256_shuffle_epi8(_mm256_loadu_si256(src + 1), evens_odds);
+            // The 64-bit unpacks work within lanes, leaving the groups of 8 pixels in 0, 2, 1, 3 order
+            _mm256_storeu_si256(a++, _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(lr0, lr16), _MM_SHUFFLE(3, 1, 2, 0)));
+            _mm256_storeu_si256(b++, _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(lr0, lr16), _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+
+        byte * const tail[] = { dest[0] + i, dest[1] + i };
+        unpack_y8_y8_from_y8i(tail, source + i * 2, count - i);
+    }
+
+    SIMD_TARGET("ssse3") void unpack_y16_y16_from_y12i_10_ssse3(byte * const dest[], const byte * source, int count)
+    {
+        auto a = reinterpret_cast<__m128i *>(dest[0]);
+        auto b = reinterpret_cast<__m128i *>(dest[1]);
+        const __m128i l_lo = _mm_setr_epi8(WORD_AT_1_LO), l_hi = _mm_setr_epi8(WORD_AT_1_HI);
+        const __m128i r_lo = _mm_setr_epi8(WORD_AT_0_LO), r_hi = _mm_setr_epi8(WORD_AT_0_HI);
+
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 3));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 3 + 8));
+
+            // Left is the upper 12 bits of bytes 1-2, right the lower 12 bits of bytes 0-1
+            __m128i l = _mm_srli_epi16(_mm_or_si128(_mm_shuffle_epi8(lo, l_lo), _mm_shuffle_epi8(hi, l_hi)), 4);
+            __m128i r = _mm_and_si128(_mm_or_si128(_mm_shuffle_epi8(lo, r_lo), _mm_shuffle_epi8(hi, r_hi)), _mm_set1_epi16(0x0fff));
+            _mm_storeu_si128(a++, _mm_or_si128(_mm_slli_epi16(l, 6), _mm_srli_epi16(l, 4)));
+            _mm_storeu_si128(b++, _mm_or_si128(_mm_slli_epi16(r, 6), _mm_srli_epi16(r, 4)));
+        }
+
+        byte * const tail[] = { dest[0] + i * 2, dest[1] + i * 2 };
+        unpack_y16_y16_from_y12i_10(tail, source + i * 3, count - i);
+    }
+
+    SIMD_TARGET("avx2") void unpack_y16_y16_from_y12i_10_avx2(byte * const dest[], const byte * source, int count)
+    {
+        auto a = reinterpret_cast<__m256i *>(dest[0]);
+        auto b = reinterpret_cast<__m256i *>(dest[1]);
+        const __m256i l_lo = _mm256_broadcastsi128_si256(_mm_setr_epi8(WORD_AT_1_LO)), l_hi = _mm256_broadcastsi128_si256(_mm_setr_epi8(WORD_AT_1_HI));
+        const __m256i r_lo = _mm256_broadcastsi128_si256(_mm_setr_epi8(WORD_AT_0_LO)), r_hi = _mm256_broadcastsi128_si256(_mm_setr_epi8(WORD_AT_0_HI));
+
+        int i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i lo, hi;
+            load_3_byte_pixels_avx2(source + i * 3, lo, hi);
+
+            __m256i l = _mm256_srli_epi16(_mm256_or_si256(_mm256_shuffle_epi8(lo, l_lo), _mm256_shuffle_epi8(hi, l_hi)), 4);
+            __m256i r = _mm256_and_si256(_mm256_or_si256(_mm256_shuffle_epi8(lo, r_lo), _mm256_shuffle_epi8(hi, r_hi)), _mm256_set1_epi16(0x0fff));
+            _mm256_storeu_si256(a++, _mm256_or_si256(_mm256_slli_epi16(l, 6), _mm256_srli_epi16(l, 4)));
+            _mm256_storeu_si256(b++, _mm256_or_si256(_mm256_slli_epi16(r, 6), _mm256_srli_epi16(r, 4)));
+        }
+
+        byte * const tail[] = { dest[0] + i * 2, dest[1] + i * 2 };
+        unpack_y16_y16_from_y12i_10(tail, source + i * 3, count - i);
+    }
+
+    template<bool Y16> SIMD_TARGET("ssse3") void unpack_z16_y_from_f200_inzi_ssse3(byte * const dest[], const byte * source, int count)
+    {
+        const __m128i z_lo = _mm_setr_epi8(WORD_AT_0_LO), z_hi = _mm_setr_epi8(WORD_AT_0_HI);
+        const __m128i y_lo = _mm_setr_epi8(BYTE_AT_2_LO), y_hi = _mm_setr_epi8(BYTE_AT_2_HI);
+
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 3));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 3 + 8));
+
+            __m128i z = _mm_or_si128(_mm_shuffle_epi8(lo, z_lo), _mm_shuffle_epi8(hi, z_hi));
+            __m128i y = _mm_or_si128(_mm_shuffle_epi8(lo, y_lo), _mm_shuffle_epi8(hi, y_hi)); // 8 bytes
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest[0] + i * 2), z);
+            if (Y16) _mm_storeu_si128(reinterpret_cast<__m128i *>(dest[1] + i * 2), _mm_unpacklo_epi8(y, y));
+            else     _mm_storel_epi64(reinterpret_cast<__m128i *>(dest[1] + i), y);
+        }
+
+        byte * const tail[] = { dest[0] + i * 2, dest[1] + i * (Y16 ? 2 : 1) };
+        if (Y16) unpack_z16_y16_from_f200_inzi(tail, source + i * 3, count - i);
+        else     unpack_z16_y8_from_f200_inzi(tail, source + i * 3, count - i);
+    }
+
+    template<bool Y16> SIMD_TARGET("avx2") void unpack_z16_y_from_f200_inzi_avx2(byte * const dest[], const byte * source, int count)
+    {
+        const __m256i z_lo = _mm256_broadcastsi128_si256(_mm_setr_epi8(WORD_AT_0_LO)), z_hi = _mm256_broadcastsi128_si256(_mm_setr_epi8(WORD_AT_0_HI));
+        const __m256i y_lo = _mm256_broadcastsi128_si256(_mm_setr_epi8(BYTE_AT_2_LO)), y_hi = _mm256_broadcastsi128_si256(_mm_setr_epi8(BYTE_AT_2_HI));
+
+        int i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i lo, hi;
+            load_3_byte_pixels_avx2(source + i * 3, lo, hi);
+
+            __m256i z = _mm256_or_si256(_mm256_shuffle_epi8(lo, z_lo), _mm256_shuffle_epi8(hi, z_hi));
+            __m256i y = _mm256_or_si256(_mm256_shuffle_epi8(lo, y_lo), _mm256_shuffle_epi8(hi, y_hi)); // 8 bytes per lane
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest[0] + i * 2), z);
+            if (Y16) _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest[1] + i * 2), _mm256_unpacklo_epi8(y, y));
+            else     _mm_storeu_si128(reinterpret_cast<__m128i *>(dest[1] + i), _mm256_castsi256_si128(_mm256_permute4x64_epi64(y, _MM_SHUFFLE(3, 1, 2, 0))));
+        }
+
+        byte * const tail[] = { dest[0] + i * 2, dest[1] + i * (Y16 ? 2 : 1) };
+        if (Y16) unpack_z16_y16_from_f200_inzi(tail, source + i * 3, count - i);
+        else     unpack_z16_y8_from_f200_inzi(tail, source + i * 3, count - i);
+    }
+
+    #undef WORD_AT_0_LO
+    #undef WORD_AT_0_HI
+    #undef WORD_AT_1_LO
+    #undef WORD_AT_1_HI
+    #undef BYTE_AT_2_LO
+    #undef BYTE_AT_2_HI
+
+    // The SR300 INZI frame is planar, only the IR plane needs converting
+    template<bool Y16> SIMD_TARGET("ssse3") void unpack_z16_y_from_sr300_inzi_ssse3(byte * const dest[], const byte * source, int count)
+    {
+        auto in = reinterpret_cast<const uint16_t *>(source);
+        int i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i ir0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            __m128i ir8 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i + 8));
+            if (Y16)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dest[1] + i * 2), _mm_slli_epi16(ir0, 6));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dest[1] + i * 2 + 16), _mm_slli_epi16(ir8, 6));
+            }
+            else
+            {
+                // Mask before packing, so that out of range values are truncated as in the scalar code rather than saturated
+                const __m128i low_byte = _mm_set1_epi16(0xff);
+                __m128i y8 = _mm_packus_epi16(_mm_and_si128(_mm_srli_epi16(ir0, 2), low_byte), _mm_and_si128(_mm_srli_epi16(ir8, 2), low_byte));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dest[1] + i), y8);
+            }
+        }
+        for (; i < count; ++i)
+        {
+            if (Y16) reinterpret_cast<uint16_t *>(dest[1])[i] = in[i] << 6;
+            else     dest[1][i] = in[i] >> 2;
+        }
+        librealsense::copy(dest[0], in + count, count * 2);
+    }
+
+    template<bool Y16> SIMD_TARGET("avx2") void unpack_z16_y_from_sr300_inzi_avx2(byte * const dest[], const byte * source, int count)
+    {
+        auto in = reinterpret_cast<const uint16_t *>(source);
+        int i = 0;
+        for (; i + 32 <= count; i += 32)
+        {
+            __m256i ir0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+            __m256i ir16 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i + 16));
+            if (Y16)
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest[1] + i * 2), _mm256_slli_epi16(ir0, 6));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest[1] + i * 2 + 32), _mm256_slli_epi16(ir16, 6));
+            }
+            else
+            {
+                const __m256i low_byte = _mm256_set1_epi16(0xff);
+                __m256i y8 = _mm256_packus_epi16(_mm256_and_si256(_mm256_srli_epi16(ir0, 2), low_byte), _mm256_and_si256(_mm256_srli_epi16(ir16, 2), low_byte));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest[1] + i), _mm256_permute4x64_epi64(y8, _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+        }
+        for (; i < count; ++i)
+        {
+            if (Y16) reinterpret_cast<uint16_t *>(dest[1])[i] = in[i] << 6;
+            else     dest[1][i] = in[i] >> 2;
+        }
+        librealsense::copy(dest[0], in + count, count * 2);
+    }
+#endif
+
     void unpack_rgb_from_bgr(byte * const dest[], const byte * source, int count)
     {
         auto in = reinterpret_cast<const uint8_t *>(source);
@@ -823,11 +1779,138 @@ namespace librealsense
         }
     }
 
-#ifdef ZERO_COPY
-    constexpr bool requires_processing = false;
+    ///////////////////////////////
+    // Unpacker kernel selection //
+    ///////////////////////////////
+
+    // The fastest variant the CPU supports is picked once, as the native pixel format tables below are initialized
+    template<rs2_format FORMAT> unpack_function yuy2_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_yuy2<FORMAT>, &unpack_yuy2_ssse3<FORMAT>, &unpack_yuv422_avx2<FORMAT, false>, &unpack_yuv422_avx512<FORMAT, false>);
 #else
-    constexpr bool requires_processing = true;
+        return &unpack_yuy2<FORMAT>;
 #endif
+    }
+
+    template<rs2_format FORMAT> unpack_function uyvy_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_uyvy<FORMAT>, &unpack_uyvy_ssse3<FORMAT>, &unpack_yuv422_avx2<FORMAT, true>, &unpack_yuv422_avx512<FORMAT, true>);
+#else
+        return &unpack_uyvy<FORMAT>;
+#endif
+    }
+
+    // Converting to 4:2:0 is bound by memory bandwidth well before AVX2 runs out of compute, so AVX-512 CPUs use the AVX2 routine
+    template<bool NV12> unpack_frame_function yuy2_420_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker<unpack_frame_function>(&unpack_420_from_yuy2<NV12, &unpack_420_rows_from_yuy2<NV12>>,
+                                                      &unpack_420_from_yuy2<NV12, &unpack_420_rows_from_yuy2_ssse3<NV12>>,
+                                                      &unpack_420_from_yuy2<NV12, &unpack_420_rows_from_yuy2_avx2<NV12>>,
+                                                      &unpack_420_from_yuy2<NV12, &unpack_420_rows_from_yuy2_avx2<NV12>>);
+#else
+        return &unpack_420_from_yuy2<NV12, &unpack_420_rows_from_yuy2<NV12>>;
+#endif
+    }
+
+    // Only the colour conversion is vectorized; the block averaging ahead of it is left to the compiler
+    template<rs2_format FORMAT, int SCALE> unpack_frame_function yuy2_downscale_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker<unpack_frame_function>(&unpack_downscaled_from_yuy2<FORMAT, SCALE, &convert_yuv_row<FORMAT>>,
+                                                      &unpack_downscaled_from_yuy2<FORMAT, SCALE, &convert_yuv_row<FORMAT>>,
+                                                      &unpack_downscaled_from_yuy2<FORMAT, SCALE, &convert_yuv_row_avx2<FORMAT>>,
+                                                      &unpack_downscaled_from_yuy2<FORMAT, SCALE, &convert_yuv_row_avx2<FORMAT>>);
+#else
+        return &unpack_downscaled_from_yuy2<FORMAT, SCALE, &convert_yuv_row<FORMAT>>;
+#endif
+    }
+
+    unpack_function y8_from_rw10_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_y8_from_rw10, &unpack_y8_from_rw10_ssse3, &unpack_y8_from_rw10_avx2, &unpack_y8_from_rw10_avx512);
+#else
+        return &unpack_y8_from_rw10;
+#endif
+    }
+
+    std::vector<unpacker_variant> get_y8_from_rw10_unpackers()
+    {
+        std::vector<unpacker_variant> variants = { { "scalar", &unpack_y8_from_rw10, true } };
+#ifdef RS2_SIMD_DISPATCH
+        auto level = get_simd_level();
+        variants.push_back({ "ssse3", &unpack_y8_from_rw10_ssse3, level >= simd_level::ssse3 });
+        variants.push_back({ "avx2", &unpack_y8_from_rw10_avx2, level >= simd_level::avx2 });
+        variants.push_back({ "avx512", &unpack_y8_from_rw10_avx512, level >= simd_level::avx512 });
+#endif
+        return variants;
+    }
+
+    unpack_function rw10_from_rw8_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_rw10_from_rw8, &unpack_rw10_from_rw8_ssse3, &unpack_rw10_from_rw8_avx2, &unpack_rw10_from_rw8_avx512);
+#else
+        return &unpack_rw10_from_rw8;
+#endif
+    }
+
+    unpack_function y8_y8_from_y8i_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_y8_y8_from_y8i, &unpack_y8_y8_from_y8i_ssse3, &unpack_y8_y8_from_y8i_avx2, &unpack_y8_y8_from_y8i_avx2);
+#else
+        return &unpack_y8_y8_from_y8i;
+#endif
+    }
+
+    unpack_function y16_y16_from_y12i_10_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_y16_y16_from_y12i_10, &unpack_y16_y16_from_y12i_10_ssse3, &unpack_y16_y16_from_y12i_10_avx2, &unpack_y16_y16_from_y12i_10_avx2);
+#else
+        return &unpack_y16_y16_from_y12i_10;
+#endif
+    }
+
+    unpack_function z16_y8_from_f200_inzi_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_z16_y8_from_f200_inzi, &unpack_z16_y_from_f200_inzi_ssse3<false>, &unpack_z16_y_from_f200_inzi_avx2<false>, &unpack_z16_y_from_f200_inzi_avx2<false>);
+#else
+        return &unpack_z16_y8_from_f200_inzi;
+#endif
+    }
+
+    unpack_function z16_y16_from_f200_inzi_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_z16_y16_from_f200_inzi, &unpack_z16_y_from_f200_inzi_ssse3<true>, &unpack_z16_y_from_f200_inzi_avx2<true>, &unpack_z16_y_from_f200_inzi_avx2<true>);
+#else
+        return &unpack_z16_y16_from_f200_inzi;
+#endif
+    }
+
+    unpack_function z16_y8_from_sr300_inzi_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_z16_y8_from_sr300_inzi, &unpack_z16_y_from_sr300_inzi_ssse3<false>, &unpack_z16_y_from_sr300_inzi_avx2<false>, &unpack_z16_y_from_sr300_inzi_avx2<false>);
+#else
+        return &unpack_z16_y8_from_sr300_inzi;
+#endif
+    }
+
+    unpack_function z16_y16_from_sr300_inzi_unpacker()
+    {
+#ifdef RS2_SIMD_DISPATCH
+        return select_unpacker(&unpack_z16_y16_from_sr300_inzi, &unpack_z16_y_from_sr300_inzi_ssse3<true>, &unpack_z16_y_from_sr300_inzi_avx2<true>, &unpack_z16_y_from_sr300_inzi_avx2<true>);
+#else
+        return &unpack_z16_y16_from_sr300_inzi;
+#endif
+    }
 
     //////////////////////////
     // Native pixel formats //
@@ -838,48 +1921,60 @@ namespace librealsense
     const native_pixel_format pf_bayer16    = { 'BYR2', 1, 2,{  { false, &copy_pixels<2>,                                { { RS2_STREAM_COLOR,    RS2_FORMAT_RAW16 } } } } };
     const native_pixel_format pf_rw10       = { 'pRAA', 1, 1,{  { false, &copy_raw10,                                    { { RS2_STREAM_COLOR,    RS2_FORMAT_RAW10 } } } } };
     // W10 development format will be exposed to the user via Y8
-    const native_pixel_format pf_w10        = { 'W10 ', 1, 1,{  { true,  &unpack_y8_from_rw10,                         { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8 } } } } };
+    const native_pixel_format pf_w10        = { 'W10 ', 1, 1,{  { true,  y8_from_rw10_unpacker(),                      { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8 } } } } };
 
-    const native_pixel_format pf_yuy2       = { 'YUY2', 1, 2,{  { true,  &unpack_yuy2<RS2_FORMAT_RGB8 >,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_Y16>,                    { { RS2_STREAM_COLOR,    RS2_FORMAT_Y16 } } },
+    const native_pixel_format pf_yuy2       = { 'YUY2', 1, 2,{  { true,  yuy2_unpacker<RS2_FORMAT_RGB8 >(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } }, 16 },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_Y16>(),                 { { RS2_STREAM_COLOR,    RS2_FORMAT_Y16 } }, 16 },
                                                                 { false, &copy_pixels<2>,                                 { { RS2_STREAM_COLOR,    RS2_FORMAT_YUYV } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_RGBA8>,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_RGBA8 } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_BGR8 >,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_BGRA8>,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_BGRA8 } } } } };
-
-    const native_pixel_format pf_y8         = { 'GREY', 1, 1,{  { requires_processing, &copy_pixels<1>,                                { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8  } } } } };
-    const native_pixel_format pf_y16        = { 'Y16 ', 1, 2,{  { true,  &unpack_y16_from_y16_10,                        { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } } } } };
-    const native_pixel_format pf_y8i        = { 'Y8I ', 1, 2,{  { true,  &unpack_y8_y8_from_y8i,                         { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8  },{ { RS2_STREAM_INFRARED, 2 }, RS2_FORMAT_Y8 } } } } };
-    const native_pixel_format pf_y12i       = { 'Y12I', 1, 3,{  { true,  &unpack_y16_y16_from_y12i_10,                   { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 },{ { RS2_STREAM_INFRARED, 2 }, RS2_FORMAT_Y16 } } } } };
-    const native_pixel_format pf_z16        = { 'Z16 ', 1, 2,{  { requires_processing, &copy_pixels<2>,                                { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 } } },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_RGBA8>(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_RGBA8 } }, 16 },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_BGR8 >(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } }, 16 },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_BGRA8>(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_BGRA8 } }, 16 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_NV12 } }, 0, yuy2_420_unpacker<true>() },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_I420 } }, 0, yuy2_420_unpacker<false>() },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_RGB8, 2>(), 2 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_BGR8, 2>(), 2 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_RGB8, 3>(), 3 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_BGR8, 3>(), 3 } } };
+
+    const native_pixel_format pf_y8         = { 'GREY', 1, 1,{  { false, &copy_pixels<1>,                                { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8  } } } } };
+    const native_pixel_format pf_y16        = { 'Y16 ', 1, 2,{  { true,  &unpack_y16_from_y16_10,                        { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } }, 1 } } };
+    const native_pixel_format pf_y8i        = { 'Y8I ', 1, 2,{  { true,  y8_y8_from_y8i_unpacker(),                      { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8  },{ { RS2_STREAM_INFRARED, 2 }, RS2_FORMAT_Y8 } }, 1 } } };
+    const native_pixel_format pf_y12i       = { 'Y12I', 1, 3,{  { true,  y16_y16_from_y12i_10_unpacker(),                { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 },{ { RS2_STREAM_INFRARED, 2 }, RS2_FORMAT_Y16 } }, 1 } } };
+    const native_pixel_format pf_z16        = { 'Z16 ', 1, 2,{  { false, &copy_pixels<2>,                                { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 } } },
                                                                 // The Disparity_Z is not applicable for D4XX. TODO - merge with INVZ when confirmed
                                                                 /*{ false, &copy_pixels<2>,                                { { RS2_STREAM_DEPTH,    RS2_FORMAT_DISPARITY16 } } }*/ } };
     const native_pixel_format pf_invz       = { 'Z16 ', 1, 2, { { false, &copy_pixels<2>,                                { { RS2_STREAM_DEPTH, RS2_FORMAT_Z16 } } } } };
     const native_pixel_format pf_f200_invi  = { 'INVI', 1, 1, { { false, &copy_pixels<1>,                                { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8  } } },
-                                                                { true,  &unpack_y16_from_y8,                            { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } } } } };
-    const native_pixel_format pf_f200_inzi  = { 'INZI', 1, 3,{  { true,  &unpack_z16_y8_from_f200_inzi,                  { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8 } } },
-                                                                { true,  &unpack_z16_y16_from_f200_inzi,                 { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } } } } };
-    const native_pixel_format pf_sr300_invi = { 'INVI', 1, 2,{  { true,  &unpack_y8_from_y16_10,                         { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8  } } },
-                                                                { true,  &unpack_y16_from_y16_10,                        { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } } } } };
-    const native_pixel_format pf_sr300_inzi = { 'INZI', 2, 2,{  { true,  &unpack_z16_y8_from_sr300_inzi,                 { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8 } } },
-                                                                { true,  &unpack_z16_y16_from_sr300_inzi,                { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } } } } };
-
-    const native_pixel_format pf_uyvyl      = { 'UYVY', 1, 2,{  { true,  &unpack_uyvy<RS2_FORMAT_RGB8 >,                  { { RS2_STREAM_INFRARED, RS2_FORMAT_RGB8 } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_Y16>,                    { { RS2_STREAM_INFRARED, RS2_FORMAT_Y16 } } },
+                                                                { true,  &unpack_y16_from_y8,                            { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } }, 1 } } };
+    const native_pixel_format pf_f200_inzi  = { 'INZI', 1, 3,{  { true,  z16_y8_from_f200_inzi_unpacker(),               { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8 } }, 1 },
+                                                                { true,  z16_y16_from_f200_inzi_unpacker(),              { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } }, 1 } } };
+    const native_pixel_format pf_sr300_invi = { 'INVI', 1, 2,{  { true,  &unpack_y8_from_y16_10,                         { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8  } }, 1 },
+                                                                { true,  &unpack_y16_from_y16_10,                        { { { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } }, 1 } } };
+    const native_pixel_format pf_sr300_inzi = { 'INZI', 2, 2,{  { true,  z16_y8_from_sr300_inzi_unpacker(),              { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y8 } } },
+                                                                { true,  z16_y16_from_sr300_inzi_unpacker(),             { { RS2_STREAM_DEPTH,    RS2_FORMAT_Z16 },{ { RS2_STREAM_INFRARED, 1 }, RS2_FORMAT_Y16 } } } } };
+
+    const native_pixel_format pf_uyvyl      = { 'UYVY', 1, 2,{  { true,  uyvy_unpacker<RS2_FORMAT_RGB8 >(),               { { RS2_STREAM_INFRARED, RS2_FORMAT_RGB8 } }, 16 },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_Y16>(),                 { { RS2_STREAM_INFRARED, RS2_FORMAT_Y16 } }, 16 },
                                                                 { false, &copy_pixels<2>,                                 { { RS2_STREAM_INFRARED, RS2_FORMAT_UYVY } } },
-                                                                { true,  &unpack_uyvy<RS2_FORMAT_RGBA8>,                  { { RS2_STREAM_INFRARED, RS2_FORMAT_RGBA8} } },
-                                                                { true,  &unpack_uyvy<RS2_FORMAT_BGR8 >,                  { { RS2_STREAM_INFRARED, RS2_FORMAT_BGR8 } } },
-                                                                { true,  &unpack_uyvy<RS2_FORMAT_BGRA8>,                  { { RS2_STREAM_INFRARED, RS2_FORMAT_BGRA8} } } } };
+                                                                { true,  uyvy_unpacker<RS2_FORMAT_RGBA8>(),               { { RS2_STREAM_INFRARED, RS2_FORMAT_RGBA8} }, 16 },
+                                                                { true,  uyvy_unpacker<RS2_FORMAT_BGR8 >(),               { { RS2_STREAM_INFRARED, RS2_FORMAT_BGR8 } }, 16 },
+                                                                { true,  uyvy_unpacker<RS2_FORMAT_BGRA8>(),               { { RS2_STREAM_INFRARED, RS2_FORMAT_BGRA8} }, 16 } } };
 
     const native_pixel_format pf_rgb888     = { 'RGB2', 1, 2,{  { true,  &unpack_rgb_from_bgr,                            { { RS2_STREAM_INFRARED, RS2_FORMAT_RGB8 } } } } };
 
 
-    const native_pixel_format pf_yuyv       = { 'YUYV', 1, 2,{  { true,  &unpack_yuy2<RS2_FORMAT_RGB8 >,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_Y16>,                    { { RS2_STREAM_COLOR,    RS2_FORMAT_Y16 } } },
+    const native_pixel_format pf_yuyv       = { 'YUYV', 1, 2,{  { true,  yuy2_unpacker<RS2_FORMAT_RGB8 >(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } }, 16 },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_Y16>(),                 { { RS2_STREAM_COLOR,    RS2_FORMAT_Y16 } }, 16 },
                                                                 { false, &copy_pixels<2>,                                 { { RS2_STREAM_COLOR,    RS2_FORMAT_YUYV } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_RGBA8>,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_RGBA8 } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_BGR8 >,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } } },
-                                                                { true,  &unpack_yuy2<RS2_FORMAT_BGRA8>,                  { { RS2_STREAM_COLOR,    RS2_FORMAT_BGRA8 } } } } };
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_RGBA8>(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_RGBA8 } }, 16 },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_BGR8 >(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } }, 16 },
+                                                                { true,  yuy2_unpacker<RS2_FORMAT_BGRA8>(),               { { RS2_STREAM_COLOR,    RS2_FORMAT_BGRA8 } }, 16 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_NV12 } }, 0, yuy2_420_unpacker<true>() },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_I420 } }, 0, yuy2_420_unpacker<false>() },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_RGB8, 2>(), 2 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_BGR8, 2>(), 2 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_RGB8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_RGB8, 3>(), 3 },
+                                                                { true,  nullptr,                                         { { RS2_STREAM_COLOR,    RS2_FORMAT_BGR8 } }, 0, yuy2_downscale_unpacker<RS2_FORMAT_BGR8, 3>(), 3 } } };
 
     const native_pixel_format pf_accel_axes = { 'ACCL', 1, 1,{  { true,  &unpack_accel_axes<RS2_FORMAT_MOTION_XYZ32F>,    { { RS2_STREAM_ACCEL,    RS2_FORMAT_MOTION_XYZ32F } } },
                                                                 { false, &unpack_hid_raw_data,                            { { RS2_STREAM_ACCEL,    RS2_FORMAT_MOTION_RAW  } } }}};
@@ -12,6 +12,7 @@ namespace librealsense
 
     size_t           get_image_size                 (int width, int height, rs2_format format);
     int              get_image_bpp                  (rs2_format format);
+    int              get_image_stride               (int width, rs2_format format);
     void             deproject_z                    (float * points, const rs2_intrinsics & z_intrin, const uint16_t * z_pixels, float z_scale);
     void             deproject_disparity            (float * points, const rs2_intrinsics & disparity_intrin, const uint16_t * disparity_pixels, float disparity_scale);
 
@@ -24,6 +25,17 @@ namespace librealsense
     void             align_other_to_disparity       (byte * other_aligned_to_disparity, const uint16_t * disparity_pixels, float disparity_scale, const rs2_intrinsics & disparity_intrin,
                                                      const rs2_extrinsics & disparity_to_other, const rs2_intrinsics & other_intrin, const byte * other_pixels, rs2_format other_format);
 
+    // A variant of a SIMD-dispatched unpacker, and whether this CPU can run it
+    struct unpacker_variant
+    {
+        const char * name;
+        void(*unpack)(byte * const dest[], const byte * source, int count);
+        bool supported;
+    };
+
+    // Every variant of the RW10 to Y8 unpacker, the scalar reference first, so they can be checked against each other
+    std::vector<unpacker_variant> get_y8_from_rw10_unpackers();
+
     std::vector<int> compute_rectification_table    (const rs2_intrinsics & rect_intrin, const rs2_extrinsics & rect_to_unrect, const rs2_intrinsics & unrect_intrin);
     void             rectify_image                  (uint8_t * rect_pixels, const std::vector<int> & rectification_table, const uint8_t * unrect_pixels, rs2_format format);
 
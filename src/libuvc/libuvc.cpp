@@ -278,7 +278,7 @@ namespace librealsense
             }
 
             /* request to set up a streaming profile and its calback */
-            void probe_and_commit(stream_profile profile, frame_callback callback, int buffers) override
+            int probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory memory) override
             {
                 uvc_error_t res;
                 uvc_stream_ctrl_t ctrl;
@@ -302,6 +302,7 @@ namespace librealsense
                 _profiles.push_back(profile);
                 _callbacks.push_back(callback);
                 _stream_ctrls.push_back(ctrl);
+                return buffers;
             }
 
             /* request to start streaming*/
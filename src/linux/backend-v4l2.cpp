@@ -38,6 +38,11 @@
 #include <linux/usb/video.h>
 #include <linux/uvcvideo.h>
 #include <linux/videodev2.h>
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5,6,0)
+#include <linux/dma-heap.h>
+#define DMA_HEAP_SUPPORTED
+#endif
 #include <fts.h>
 #include <regex>
 #include <list>
@@ -178,19 +183,40 @@ namespace librealsense
         }
 
 
-        buffer::buffer(int fd, bool use_memory_map, int index)
-            : _use_memory_map(use_memory_map), _index(index)
+        // Allocates a buffer of the given size from the system DMA heap, returning its file descriptor
+        static int allocate_dma_buffer(size_t size)
+        {
+#ifdef DMA_HEAP_SUPPORTED
+            auto heap = open("/dev/dma_heap/system", O_RDWR | O_CLOEXEC);
+            if (heap < 0)
+                throw linux_backend_exception("Failed to open the system DMA heap");
+
+            dma_heap_allocation_data alloc = {};
+            alloc.len = size;
+            alloc.fd_flags = O_RDWR | O_CLOEXEC;
+            auto res = xioctl(heap, DMA_HEAP_IOCTL_ALLOC, &alloc);
+            ::close(heap);
+            if (res < 0)
+                throw linux_backend_exception("xioctl(DMA_HEAP_IOCTL_ALLOC) failed");
+            return static_cast<int>(alloc.fd);
+#else
+            throw linux_backend_exception("DMA buffer capture requires Linux 5.6 or later");
+#endif
+        }
+
+        buffer::buffer(int fd, v4l2_memory memory, int index, size_t image_size)
+            : _memory(memory), _index(index)
         {
             v4l2_buffer buf = {};
             buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-            buf.memory = use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+            buf.memory = memory;
             buf.index = index;
             if(xioctl(fd, VIDIOC_QUERYBUF, &buf) < 0)
                 throw linux_backend_exception("xioctl(VIDIOC_QUERYBUF) failed");
 
             _original_length = buf.length;
             _length = buf.length;
-            if (use_memory_map)
+            if (memory == V4L2_MEMORY_MMAP)
             {
                 _start = static_cast<uint8_t*>(mmap(NULL, buf.length,
                                                     PROT_READ | PROT_WRITE, MAP_SHARED,
@@ -198,6 +224,22 @@ namespace librealsense
                 if(_start == MAP_FAILED)
                     throw linux_backend_exception("mmap failed");
             }
+            else if (memory == V4L2_MEMORY_DMABUF)
+            {
+                // Imported buffers are sized by the driver's image size, metadata is appended past the image
+                _original_length = image_size;
+                _length = image_size + MAX_META_DATA_SIZE;
+                _dmabuf_fd = allocate_dma_buffer(_length);
+                _start = static_cast<uint8_t*>(mmap(NULL, _length,
+                                                    PROT_READ | PROT_WRITE, MAP_SHARED,
+                                                    _dmabuf_fd, 0));
+                if (_start == MAP_FAILED)
+                {
+                    ::close(_dmabuf_fd);
+                    throw linux_backend_exception("mmap of DMA buffer failed");
+                }
+                memset(_start, 0, _length);
+            }
             else
             {
                 _length += MAX_META_DATA_SIZE;
@@ -211,25 +253,35 @@ namespace librealsense
         {
             v4l2_buffer buf = {};
             buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+            buf.memory = _memory;
             buf.index = _index;
             buf.length = _length;
 
-            if ( !_use_memory_map )
+            if (_memory == V4L2_MEMORY_USERPTR)
             {
                 buf.m.userptr = (unsigned long)_start;
             }
+            else if (_memory == V4L2_MEMORY_DMABUF)
+            {
+                buf.m.fd = _dmabuf_fd;
+            }
             if(xioctl(fd, VIDIOC_QBUF, &buf) < 0)
                 throw linux_backend_exception("xioctl(VIDIOC_QBUF) failed");
         }
 
         buffer::~buffer()
         {
-            if (_use_memory_map)
+            if (_memory == V4L2_MEMORY_MMAP)
             {
                if(munmap(_start, _length) < 0)
                    linux_backend_exception("munmap");
             }
+            else if (_memory == V4L2_MEMORY_DMABUF)
+            {
+               if(munmap(_start, _length) < 0)
+                   linux_backend_exception("munmap");
+               ::close(_dmabuf_fd);
+            }
             else
             {
                free(_start);
@@ -255,7 +307,7 @@ namespace librealsense
 
             if (_must_enqueue)
             {
-                if (V4L2_MEMORY_USERPTR == _use_memory_map)
+                if (V4L2_MEMORY_MMAP != _memory)
                 {
                     auto metadata_offset = get_full_length() - MAX_META_DATA_SIZE;
                     memset((byte*)(get_frame_start()) + metadata_offset, 0, MAX_META_DATA_SIZE);
@@ -492,6 +544,7 @@ namespace librealsense
               _is_alive(true),
               _thread(nullptr),
               _use_memory_map(use_memory_map),
+              _memory(use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR),
               _is_started(false),
               _stop_pipe_fd{}
         {
@@ -516,10 +569,18 @@ namespace librealsense
             if (_thread) _thread->join();
         }
 
-        void v4l_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers)
+        int v4l_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory memory)
         {
             if(!_is_capturing && !_callback)
             {
+                switch (memory)
+                {
+                case CAPTURE_MEMORY_MMAP: _memory = V4L2_MEMORY_MMAP; break;
+                case CAPTURE_MEMORY_USERPTR: _memory = V4L2_MEMORY_USERPTR; break;
+                case CAPTURE_MEMORY_DMABUF: _memory = V4L2_MEMORY_DMABUF; break;
+                default: _memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR; break;
+                }
+
                 v4l2_fmtdesc pixel_format = {};
                 pixel_format.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
                 while (ioctl(_fd, VIDIOC_ENUM_FMT, &pixel_format) == 0)
@@ -596,22 +657,37 @@ namespace librealsense
                 v4l2_requestbuffers req = {};
                 req.count = buffers;
                 req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-                req.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                req.memory = _memory;
                 if(xioctl(_fd, VIDIOC_REQBUFS, &req) < 0)
                 {
                     if(errno == EINVAL)
-                        throw linux_backend_exception(_name + " does not support memory mapping");
+                        throw linux_backend_exception(to_string() << _name << " does not support capture memory type " << _memory);
                     else
                         throw linux_backend_exception("xioctl(VIDIOC_REQBUFS) failed");
                 }
 
-                for(size_t i = 0; i < buffers; ++i)
+                // The driver may grant fewer buffers than requested
+                try
+                {
+                    for(size_t i = 0; i < req.count; ++i)
+                    {
+                        _buffers.push_back(std::make_shared<buffer>(_fd, _memory, i, fmt.fmt.pix.sizeimage));
+                    }
+                }
+                catch (...)
                 {
-                    _buffers.push_back(std::make_shared<buffer>(_fd, _use_memory_map, i));
+                    // close() only cleans up after a committed stream, so release the buffers set up so far here:
+                    // unmap or free them, close their DMA buffers and hand them back to the driver
+                    _buffers.resize(0);
+                    req.count = 0;
+                    if (xioctl(_fd, VIDIOC_REQBUFS, &req) < 0)
+                        LOG_ERROR("xioctl(VIDIOC_REQBUFS) failed to release the buffers of " << _name);
+                    throw;
                 }
 
                 _profile =  profile;
                 _callback = callback;
+                return static_cast<int>(req.count);
             }
             else
             {
@@ -677,7 +753,7 @@ namespace librealsense
                 struct v4l2_requestbuffers req = {};
                 req.count = 0;
                 req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-                req.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                req.memory = _memory;
                 if(xioctl(_fd, VIDIOC_REQBUFS, &req) < 0)
                 {
                     if(errno == EINVAL)
@@ -754,7 +830,7 @@ namespace librealsense
                     FD_SET(_fd, &fds);
                     v4l2_buffer buf = {};
                     buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-                    buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                    buf.memory = _memory;
                     if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
                     {
                         if(errno == EAGAIN)
@@ -1192,7 +1268,7 @@ namespace librealsense
 
         bool v4l_uvc_device::has_metadata()
         {
-            return !_use_memory_map;
+            return _memory != V4L2_MEMORY_MMAP;
         }
 
         std::shared_ptr<uvc_device> v4l_backend::create_uvc_device(uvc_device_info info) const
@@ -80,7 +80,7 @@ namespace librealsense
         class buffer
         {
         public:
-            buffer(int fd, bool use_memory_map, int index);
+            buffer(int fd, v4l2_memory memory, int index, size_t image_size);
 
             void prepare_for_streaming(int fd);
 
@@ -101,7 +101,8 @@ namespace librealsense
             uint8_t* _start;
             size_t _length;
             size_t _original_length;
-            bool _use_memory_map;
+            v4l2_memory _memory;
+            int _dmabuf_fd = -1;
             int _index;
             v4l2_buffer _buf;
             std::mutex _mutex;
@@ -141,7 +142,7 @@ namespace librealsense
 
             ~v4l_uvc_device();
 
-            void probe_and_commit(stream_profile profile, frame_callback callback, int buffers) override;
+            int probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory memory) override;
 
             void stream_on(std::function<void(const notification& n)> error_handler) override;
 
@@ -200,6 +201,7 @@ namespace librealsense
             std::unique_ptr<std::thread> _thread;
             std::unique_ptr<named_mutex> _named_mtx;
             bool _use_memory_map;
+            v4l2_memory _memory;
         };
 
         class v4l_backend : public backend
@@ -2,6 +2,8 @@
 
 #include <fstream>
 
+std::atomic<int> librealsense::minimum_log_severity(RS2_LOG_SEVERITY_NONE);
+
 #if BUILD_EASYLOGGINGPP
 INITIALIZE_EASYLOGGINGPP
 
@@ -61,6 +63,7 @@ namespace librealsense
             }
 
             el::Loggers::reconfigureLogger(log_id, defaultConf);
+            librealsense::minimum_log_severity = std::min(minimum_console_severity, minimum_file_severity);
         }
 
         void open_def() const
@@ -73,6 +76,7 @@ namespace librealsense
             defaultConf.setGlobally(el::ConfigurationType::ToStandardOutput, "false");
 
             el::Loggers::reconfigureLogger(log_id, defaultConf);
+            librealsense::minimum_log_severity = RS2_LOG_SEVERITY_NONE;
         }
 
 
@@ -517,6 +517,7 @@ void playback_device::try_looping()
             if (m_sample_rate > 0)
             {
                 LOG_DEBUG("Sleeping for: " << (sleep_time.count() / 1000) / 1000);
+                blocking_region blocking;
                 std::this_thread::sleep_for(sleep_time);
             }
         }
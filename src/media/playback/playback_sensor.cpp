@@ -103,6 +103,25 @@ notifications_callback_ptr playback_sensor::get_notifications_callback() const
     return _notifications_processor.get_callback();
 }
 
+void playback_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+{
+    throw not_implemented_exception("Playback frames are allocated by the file reader and do not support custom allocators");
+}
+
+rs2_frame_stats playback_sensor::get_frame_stats() const
+{
+    throw not_implemented_exception("Playback frames are allocated by the file reader, which keeps no per sensor frame statistics");
+}
+
+rs2_latency_stats playback_sensor::get_latency_stats(rs2_stream stream, int index, rs2_latency_type type) const
+{
+    throw not_implemented_exception("Playback frames are dispatched by the file reader, which keeps no per sensor latency statistics");
+}
+
+void playback_sensor::reset_latency_stats()
+{
+    throw not_implemented_exception("Playback frames are dispatched by the file reader, which keeps no per sensor latency statistics");
+}
 
 void playback_sensor::start(frame_callback_ptr callback)
 {
@@ -163,14 +182,8 @@ void playback_sensor::handle_frame(frame_holder frame, bool is_real_time)
         frame->set_stream(m_streams[std::make_pair(type, index)]);
         frame->set_sensor(shared_from_this());
         auto stream_id = frame.frame->get_stream()->get_unique_id();
-        //TODO: Ziv, remove usage of shared_ptr when frame_holder is cpoyable
-        auto pf = std::make_shared<frame_holder>(std::move(frame));
-        m_dispatchers.at(stream_id)->invoke([this, pf](dispatcher::cancellable_timer t)
-        {
-            frame_interface* pframe = nullptr;
-            std::swap((*pf).frame, pframe);
-            m_user_callback->on_frame((rs2_frame*)pframe);
-        });
+        static_assert(dispatcher::task::fits_inline<deliver_frame_task>::value, "Queuing a frame for delivery should not allocate");
+        m_dispatchers.at(stream_id)->invoke(deliver_frame_task{ this, std::move(frame) });
         if(is_real_time)
         {
             m_dispatchers.at(stream_id)->flush();
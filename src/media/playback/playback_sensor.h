@@ -46,6 +46,10 @@ namespace librealsense
         void update(const device_serializer::sensor_snapshot& sensor_snapshot);
         frame_callback_ptr get_frames_callback() const override;
         void set_frames_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
+        rs2_frame_stats get_frame_stats() const override;
+        rs2_latency_stats get_latency_stats(rs2_stream stream, int index, rs2_latency_type type) const override;
+        void reset_latency_stats() override;
         stream_profiles get_active_streams() const override;
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
         void unregister_before_start_callback(int token) override;
@@ -67,5 +71,21 @@ namespace librealsense
         const device_interface& m_parent_device;
         stream_profiles m_available_profiles;
         stream_profiles m_active_streams;
+
+        // Queued on the stream's dispatcher for every frame. Unlike a lambda, it can own the frame instead of sharing it
+        struct deliver_frame_task
+        {
+            playback_sensor* owner;
+            frame_holder frame;
+
+            void operator()(dispatcher::cancellable_timer t)
+            {
+                frame_interface* pframe = nullptr;
+                std::swap(frame.frame, pframe);
+                // The application's callback may block, lend the executor a thread for it
+                blocking_region blocking;
+                owner->m_user_callback->on_frame((rs2_frame*)pframe);
+            }
+        };
     };
 }
@@ -39,7 +39,9 @@ std::vector<std::shared_ptr<record_sensor>> record_device::create_record_sensors
         auto& live_sensor = device->get_sensor(sensor_index);
         auto recording_sensor = std::make_shared<record_sensor>(*this, live_sensor);
         m_on_notification_token = recording_sensor->on_notification += [this, recording_sensor, sensor_index](const notification& n) { write_notification(sensor_index, n); };
-        auto on_error = [recording_sensor](const std::string& s) {recording_sensor->stop_with_error(s); };
+        //The sensors outlive the write thread, so a plain pointer keeps the callback small enough to be copied into every queued frame without allocating
+        auto sensor = recording_sensor.get();
+        auto on_error = [sensor](const std::string& s) {sensor->stop_with_error(s); };
         m_on_frame_token = recording_sensor->on_frame += [this, recording_sensor, sensor_index, on_error](frame_holder f) { write_data(sensor_index, std::move(f), on_error); };
         m_on_extension_change_token = recording_sensor->on_extension_change += [this, recording_sensor, sensor_index, on_error](rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot) { write_sensor_extension_snapshot(sensor_index, ext, snapshot, on_error); };
         recording_sensor->init(); //Calling init AFTER register to the above events
@@ -110,7 +112,7 @@ std::chrono::nanoseconds librealsense::record_device::get_capture_time() const
     return (now - m_capture_time_base) - m_record_pause_time;
 }
 
-void librealsense::record_device::write_data(size_t sensor_index, librealsense::frame_holder frame, std::function<void(std::string const&)> on_error)
+void librealsense::record_device::write_data(size_t sensor_index, librealsense::frame_holder frame, const std::function<void(std::string const&)>& on_error)
 {
     //write_data is called from the sensors, when the live sensor raises a frame
 
@@ -132,40 +134,41 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
 
     m_cached_data_size = cached_data_size;
     auto capture_time = get_capture_time();
-    //TODO: remove usage of shared pointer when frame_holder is copyable
-    auto frame_holder_ptr = std::make_shared<frame_holder>();
-    *frame_holder_ptr = std::move(frame);
-    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
-        if (m_is_recording == false)
-        {
-            return; //Recording is paused
-        }
-        std::call_once(m_first_frame_flag, [&]()
-        {
-            try
-            {
-                write_header();
-            }
-            catch (const std::exception& e)
-            {
-                LOG_ERROR("Failed to write header. " << e.what());
-                on_error(to_string() << "Failed to write header. " << e.what());
-            }
-        });
+    static_assert(dispatcher::task::fits_inline<write_frame_task>::value, "Queuing a frame for writing should not allocate");
+    (*m_write_thread)->invoke(write_frame_task{ this, sensor_index, capture_time/*, data_size*/, std::move(frame), on_error });
+}
 
+void librealsense::record_device::write_frame(size_t sensor_index, std::chrono::nanoseconds capture_time, frame_holder frame, const std::function<void(std::string const&)>& on_error)
+{
+    if (m_is_recording == false)
+    {
+        return; //Recording is paused
+    }
+    std::call_once(m_first_frame_flag, [&]()
+    {
         try
         {
-            const uint32_t device_index = 0;
-            auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
-            auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
-            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
-            //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+            write_header();
         }
-        catch(std::exception& e)
+        catch (const std::exception& e)
         {
-            on_error(to_string() << "Failed to write frame. " << e.what());
+            LOG_ERROR("Failed to write header. " << e.what());
+            on_error(to_string() << "Failed to write header. " << e.what());
         }
     });
+
+    try
+    {
+        const uint32_t device_index = 0;
+        auto stream_type = frame.frame->get_stream()->get_stream_type();
+        auto stream_index = static_cast<uint32_t>(frame.frame->get_stream()->get_stream_index());
+        m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(frame));
+        //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+    }
+    catch(std::exception& e)
+    {
+        on_error(to_string() << "Failed to write frame. " << e.what());
+    }
 }
 
 const std::string& librealsense::record_device::get_info(rs2_camera_info info) const
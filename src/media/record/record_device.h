@@ -49,7 +49,8 @@ namespace librealsense
 
         void write_header();
         std::chrono::nanoseconds get_capture_time() const;
-        void write_data(size_t sensor_index, frame_holder f, std::function<void(std::string const&)> on_error);
+        void write_data(size_t sensor_index, frame_holder f, const std::function<void(std::string const&)>& on_error);
+        void write_frame(size_t sensor_index, std::chrono::nanoseconds capture_time, frame_holder frame, const std::function<void(std::string const&)>& on_error);
         void write_sensor_extension_snapshot(size_t sensor_index, rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot, std::function<void(std::string const&)> on_error);
         void write_notification(size_t sensor_index, const notification& n);
         std::vector<std::shared_ptr<record_sensor>> create_record_sensors(std::shared_ptr<device_interface> m_device);
@@ -75,6 +76,18 @@ namespace librealsense
         std::once_flag m_first_call_flag;
         void initialize_recording();
         void stop_gracefully(to_string error_msg);
+
+        //Queued on the write thread for every frame. Unlike a lambda, it can own the frame instead of sharing it
+        struct write_frame_task
+        {
+            record_device* owner;
+            size_t sensor_index;
+            std::chrono::nanoseconds capture_time;
+            frame_holder frame;
+            std::function<void(std::string const&)> on_error;
+
+            void operator()(dispatcher::cancellable_timer t) { owner->write_frame(sensor_index, capture_time, std::move(frame), on_error); }
+        };
     };
 
     MAP_EXTENSION(RS2_EXTENSION_RECORD, record_device);
@@ -109,6 +109,26 @@ notifications_callback_ptr librealsense::record_sensor::get_notifications_callba
     return m_sensor.get_notifications_callback();
 }
 
+void librealsense::record_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+{
+    m_sensor.set_frame_allocator(std::move(allocator));
+}
+
+rs2_frame_stats librealsense::record_sensor::get_frame_stats() const
+{
+    return m_sensor.get_frame_stats();
+}
+
+rs2_latency_stats librealsense::record_sensor::get_latency_stats(rs2_stream stream, int index, rs2_latency_type type) const
+{
+    return m_sensor.get_latency_stats(stream, index, type);
+}
+
+void librealsense::record_sensor::reset_latency_stats()
+{
+    m_sensor.reset_latency_stats();
+}
+
 void librealsense::record_sensor::start(frame_callback_ptr callback)
 {
     m_sensor.start(callback);
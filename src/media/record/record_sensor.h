@@ -39,6 +39,10 @@ namespace librealsense
         const device_interface& get_device() override;
         frame_callback_ptr get_frames_callback() const override;
         void set_frames_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
+        rs2_frame_stats get_frame_stats() const override;
+        rs2_latency_stats get_latency_stats(rs2_stream stream, int index, rs2_latency_type type) const override;
+        void reset_latency_stats() override;
         stream_profiles get_active_streams() const override;
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
         void unregister_before_start_callback(int token) override;
@@ -303,7 +303,7 @@ namespace librealsense
             for (int i = 0; i < static_cast<int>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); ++i)
             {
                 auto frame_md_type = static_cast<rs2_frame_metadata_value>(i);
-                md_parser_map->insert(std::make_pair(frame_md_type, std::make_shared<md_constant_parser>(frame_md_type)));
+                md_parser_map->set(frame_md_type, std::make_shared<md_constant_parser>(frame_md_type));
             }
             return md_parser_map;
         }
@@ -482,7 +482,7 @@ namespace librealsense
             frame->get_stream()->set_format(stream_format);
             frame->get_stream()->set_stream_index(stream_id.stream_index);
             frame->get_stream()->set_stream_type(stream_id.stream_type);
-            video_frame->data = std::move(msg->data);
+            librealsense::copy(video_frame->data.data(), msg->data.data(), msg->data.size());
             librealsense::frame_holder fh{ video_frame };
             LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
@@ -24,6 +24,9 @@ namespace librealsense
         RS2_FRAME_METADATA_COUNT
     };
 
+    static_assert(frame_metadata_internal::RS2_FRAME_METADATA_COUNT <= MAX_METADATA_ATTRIBUTES,
+                  "metadata parser table is too small for the internal metadata attributes");
+
     /**\brief Base class that establishes the interface for retrieving metadata attributes*/
     class md_attribute_parser_base
     {
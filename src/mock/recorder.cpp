@@ -629,11 +629,12 @@ namespace librealsense
         }
 
 
-        void record_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers)
+        int record_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory memory)
         {
-            _owner->try_record([this, callback, profile](recording* rec, lookup_key k)
+            auto granted = buffers;
+            _owner->try_record([this, callback, profile, buffers, memory, &granted](recording* rec, lookup_key k)
             {
-                _source->probe_and_commit(profile, [this, callback](stream_profile p, frame_object f, std::function<void()> continuation)
+                granted = _source->probe_and_commit(profile, [this, callback](stream_profile p, frame_object f, std::function<void()> continuation)
                 {
                     _owner->try_record([this, callback, p, &f, continuation](recording* rec1, lookup_key key1)
                     {
@@ -664,12 +665,13 @@ namespace librealsense
                         c.param6 = static_cast<int>(f.metadata_size);
                         callback(p, f, continuation);
                     }, _entity_id, call_type::uvc_frame);
-                });
+                }, buffers, memory);
 
                 vector<stream_profile> ps{ profile };
                 rec->save_stream_profiles(ps, k);
 
             }, _entity_id, call_type::uvc_probe_commit);
+            return granted;
         }
 
         void record_uvc_device::stream_on(std::function<void(const notification& n)> error_handler)
@@ -1180,7 +1182,7 @@ namespace librealsense
             });
         }
 
-        void playback_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers)
+        int playback_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory memory)
         {
             auto stored = _rec->load_stream_profiles(_entity_id, call_type::uvc_probe_commit);
             vector<stream_profile> input{ profile };
@@ -1197,6 +1199,7 @@ namespace librealsense
 
             _callbacks.erase(it, end(_callbacks));
             _commitments.push_back({ profile, callback });
+            return buffers;
         }
 
         void playback_uvc_device::stream_on(std::function<void(const notification& n)> error_handler)
@@ -195,6 +195,11 @@ namespace librealsense
                 _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map);
             }
         }
+        else
+        {
+            // Frame buffers are not cleared on allocation
+            memset(tex_ptr, 0, pframe->get_vertex_count() * sizeof(float2));
+        }
 
         get_source().frame_ready(std::move(res));
     }
@@ -3,6 +3,7 @@
 
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
+#include "trace.h"
 
 namespace librealsense
 {
@@ -34,7 +35,9 @@ namespace librealsense
                 frame_interface* ptr = nullptr;
                 std::swap(f.frame, ptr);
 
+                TRACE_SPAN_BEGIN(span, TRACE_PROCESSING_BEGIN, ptr);
                 _callback->on_frame((rs2_frame*)ptr, _source_wrapper.get_c_wrapper());
+                TRACE_SPAN_END(span, TRACE_PROCESSING_END);
             }
         }
         catch(...)
@@ -156,6 +159,7 @@ namespace librealsense
             auto frame_buff = comp->get_frames();
             for (size_t i = 0; i < comp->get_embedded_frames_count(); i++)
             {
+                *target = nullptr; // the buffer is not zeroed, leave nothing behind in the source composite
                 std::swap(*target, frame_buff[i]);
                 target++;
             }
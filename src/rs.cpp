@@ -31,6 +31,7 @@
 #include "environment.h"
 #include "proc/temporal-filter.h"
 #include "software-device.h"
+#include "trace.h"
 
 ////////////////////////
 // API implementation //
@@ -183,6 +184,7 @@ void notifications_processor::raise_notification(const notification n)
     {
         std::lock_guard<std::mutex> lock(_callback_mutex);
         rs2_notification noti(&n);
+        blocking_region blocking;
         if (_callback)_callback->on_notification(&noti);
     });
 }
@@ -655,6 +657,18 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, on_notification, user)
 
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(allocate);
+    VALIDATE_NOT_NULL(deallocate);
+    librealsense::frame_allocator_ptr allocator(
+        new librealsense::frame_allocator(allocate, deallocate, user),
+        [](rs2_frame_allocator* p) { delete p; });
+    sensor->sensor->set_frame_allocator(std::move(allocator));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocate, deallocate, user)
+
 void rs2_set_devices_changed_callback(const rs2_context* context, rs2_devices_changed_callback_ptr callback, void* user, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(context);
@@ -682,6 +696,39 @@ void rs2_set_notifications_callback_cpp(const rs2_sensor* sensor, rs2_notificati
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, callback)
 
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(allocator);
+    sensor->sensor->set_frame_allocator({ allocator, [](rs2_frame_allocator* p) { p->release(); } });
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocator)
+
+void rs2_get_sensor_frame_stats(const rs2_sensor* sensor, rs2_frame_stats* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(stats);
+    *stats = sensor->sensor->get_frame_stats();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, stats)
+
+void rs2_get_sensor_latency_stats(const rs2_sensor* sensor, rs2_stream stream, int index, rs2_latency_type type, rs2_latency_stats* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_ENUM(stream);
+    VALIDATE_ENUM(type);
+    VALIDATE_NOT_NULL(stats);
+    *stats = sensor->sensor->get_latency_stats(stream, index, type);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, stream, index, type, stats)
+
+void rs2_reset_sensor_latency_stats(const rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    sensor->sensor->reset_latency_stats();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor)
+
 void rs2_set_devices_changed_callback_cpp(rs2_context* context, rs2_devices_changed_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(context);
@@ -713,6 +760,19 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
+int rs2_get_frame_metadata_all(const rs2_frame* frame, rs2_metadata_type* values, int* supported, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_RANGE(count, 0, std::numeric_limits<int>::max());
+    if (count)
+    {
+        VALIDATE_NOT_NULL(values);
+        VALIDATE_NOT_NULL(supported);
+    }
+    return ((frame_interface*)frame)->get_frame_metadata_all(values, supported, count);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, values, supported, count)
+
 const char* rs2_get_notification_description(rs2_notification* notification, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(notification);
@@ -1045,6 +1105,7 @@ const char* rs2_timestamp_domain_to_string(rs2_timestamp_domain info)
 const char* rs2_notification_category_to_string(rs2_notification_category category)       { return librealsense::get_string(category);     }
 const char* rs2_sr300_visual_preset_to_string(rs2_sr300_visual_preset preset)             { return librealsense::get_string(preset);       }
 const char* rs2_log_severity_to_string(rs2_log_severity severity)                         { return librealsense::get_string(severity);     }
+const char* rs2_latency_type_to_string(rs2_latency_type type)                              { return librealsense::get_string(type);         }
 const char* rs2_exception_type_to_string(rs2_exception_type type)                         { return librealsense::get_string(type);         }
 const char* rs2_playback_status_to_string(rs2_playback_status status)                     { return librealsense::get_string(status);       }
 const char* rs2_extension_type_to_string(rs2_extension type)                              { return librealsense::get_string(type);         }
@@ -1065,6 +1126,82 @@ void rs2_log_to_file(rs2_log_severity min_severity, const char* file_path, rs2_e
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, min_severity, file_path)
 
+void rs2_enable_frame_trace(int enable, rs2_error** error) BEGIN_API_CALL
+{
+    librealsense::enable_trace(enable != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, enable)
+
+void rs2_dump_frame_trace(const char* file_path, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(file_path);
+    librealsense::dump_trace(file_path);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, file_path)
+
+namespace librealsense
+{
+    // Hands the tasks of the library to the executor of the application, wrapped as rs2_task
+    class application_executor : public executor
+    {
+    public:
+        explicit application_executor(executor_callback_ptr callback) : _callback(callback) {}
+
+        void post(task t) override
+        {
+            _callback->on_task(new rs2_task{ std::move(t) });
+        }
+
+    private:
+        executor_callback_ptr _callback;
+    };
+
+    void set_application_executor(rs2_executor_callback* callback)
+    {
+        if (!callback)
+        {
+            set_executor(nullptr);
+            return;
+        }
+        executor_callback_ptr ptr(callback, [](rs2_executor_callback* p) { p->release(); });
+        set_executor(std::make_shared<application_executor>(ptr));
+    }
+}
+
+void rs2_configure_executor(int threads, unsigned long long affinity_mask, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_RANGE(threads, 0, std::numeric_limits<int>::max());
+    configure_executor(static_cast<unsigned int>(threads), affinity_mask);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, threads, affinity_mask)
+
+void rs2_set_executor(rs2_executor_callback_ptr on_task, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    librealsense::set_application_executor(on_task ? new librealsense::executor_callback(on_task, user) : nullptr);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, on_task, user)
+
+void rs2_set_executor_cpp(rs2_executor_callback* callback, rs2_error** error) BEGIN_API_CALL
+{
+    librealsense::set_application_executor(callback);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, callback)
+
+void rs2_run_task(rs2_task* task, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(task);
+    std::unique_ptr<rs2_task> owned(task);
+    owned->task();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, task)
+
+void rs2_delete_task(rs2_task* task) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(task);
+    delete task;
+}
+NOEXCEPT_RETURN(, task)
+
 int rs2_is_sensor_extendable_to(const rs2_sensor* sensor, rs2_extension extension_type, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
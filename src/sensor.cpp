@@ -11,6 +11,7 @@
 #include "device.h"
 #include "stream.h"
 #include "sensor.h"
+#include "trace.h"
 
 namespace librealsense
 {
@@ -22,7 +23,8 @@ namespace librealsense
           _metadata_parsers(std::make_shared<metadata_parser_map>()),
           _on_open(nullptr),
           _owner(dev),
-          _profiles([this]() { return this->init_stream_profiles(); })
+          _profiles([this]() { return this->init_stream_profiles(); }),
+          _resolver_index([this]() { return this->build_resolver_index(); })
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
 
@@ -62,6 +64,13 @@ namespace librealsense
         return _notifications_processor->get_callback();
     }
 	
+    void sensor_base::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        if (_is_opened)
+            throw wrong_api_call_sequence_exception("Frame allocator can only be replaced while the sensor is closed!");
+        _source.set_allocator(std::move(allocator));
+    }
+
     int sensor_base::register_before_streaming_changes_callback(std::function<void(bool)> callback)
     {
         int token = (on_before_streaming_changes += callback);
@@ -121,104 +130,165 @@ namespace librealsense
         target->set_unique_id(stream->get_unique_id());
     }
 
+    sensor_base::resolver_index sensor_base::build_resolver_index()
+    {
+        resolver_index index;
+        for (auto&& mode : get_stream_profiles())
+        {
+            if (auto backend_profile = dynamic_cast<backend_stream_profile*>(mode.get()))
+            {
+                auto m = to_profile(mode.get());
+                auto downscaled = dynamic_cast<downscaled_video_stream_profile*>(mode.get());
+                auto scale = downscaled ? downscaled->get_scale() : 1;
+                index.fourccs[std::make_tuple(m.width, m.height, m.fps)].insert({ backend_profile->get_backend_profile().format, scale });
+
+                // The sensor doesn't list a downscaled mode it also streams natively, but can still capture it larger and downscale
+                if (downscaled) continue;
+                for (auto&& pf : _pixel_formats)
+                {
+                    if (pf.fourcc != backend_profile->get_backend_profile().format) continue;
+                    for (auto&& unpacker : pf.unpackers)
+                    {
+                        auto factor = static_cast<uint32_t>(unpacker.get_downscale());
+                        if (factor > 1 && !(m.width % factor) && !(m.height % factor))
+                            index.fourccs[std::make_tuple(m.width / factor, m.height / factor, m.fps)].insert({ pf.fourcc, static_cast<int>(factor) });
+                    }
+                }
+            }
+        }
+
+        for (size_t i = 0; i < _pixel_formats.size(); ++i)
+        {
+            auto&& unpackers = _pixel_formats[i].unpackers;
+            for (size_t j = 0; j < unpackers.size(); ++j)
+            {
+                for (auto&& output : unpackers[j].outputs)
+                {
+                    // satisfies() only looks at the first output of a stream
+                    if (unpackers[j].get_format(output.first.type, output.first.index) == output.second)
+                        index.unpackers[std::make_tuple(output.first.type, output.first.index, output.second)].push_back({ i, j });
+                }
+            }
+        }
+        return index;
+    }
+
     std::vector<request_mapping> sensor_base::resolve_requests(stream_profiles requests)
     {
-        // per requested profile, find all 4ccs that support that request.
-        std::map<int, std::set<uint32_t>> legal_fourccs;
-        auto profiles = get_stream_profiles();
+        auto&& index = *_resolver_index;
+
+        // per requested profile, find all unpackers that can produce it from a 4cc the sensor streams in the requested dimensions/fps.
+        // Unpackers are kept as (pixel format, unpacker) positions, in registration order
+        typedef std::pair<size_t, size_t> unpacker_position;
+        std::vector<std::pair<std::shared_ptr<stream_profile_interface>, std::vector<unpacker_position>>> pending;
         for (auto&& r : requests)
         {
             auto sp = to_profile(r.get());
-            for (auto&& mode : profiles)
+            std::vector<unpacker_position> candidates;
+            auto unpackers = index.unpackers.find(std::make_tuple(sp.stream, sp.index, sp.format));
+            auto fourccs = index.fourccs.find(std::make_tuple(sp.width, sp.height, sp.fps));
+            if (unpackers != index.unpackers.end() && fourccs != index.fourccs.end())
             {
-                if (auto backend_profile = dynamic_cast<backend_stream_profile*>(mode.get()))
+                for (auto&& u : unpackers->second)
                 {
-                    auto m = to_profile(mode.get());
+                    auto&& pf = _pixel_formats[u.first];
+                    if (fourccs->second.count({ pf.fourcc, pf.unpackers[u.second].get_downscale() }))
+                        candidates.push_back(u);
+                }
 
-                    if (m.fps == sp.fps && m.height == sp.height && m.width == sp.width)
-                        legal_fourccs[sp.index].insert(backend_profile->get_backend_profile().format); // TODO: Stread ID???
+                // Of the factors the resolution can be captured with, take the largest up to _max_downscale,
+                // or the smallest when all are larger, so the resolution is captured natively by default
+                auto factor = 0;
+                for (auto&& u : candidates)
+                {
+                    auto f = _pixel_formats[u.first].unpackers[u.second].get_downscale();
+                    auto allowed = f <= _max_downscale, best_allowed = factor && factor <= _max_downscale;
+                    if (!factor || (allowed != best_allowed ? allowed : (allowed ? f > factor : f < factor)))
+                        factor = f;
                 }
+                candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [&](const unpacker_position& u)
+                {
+                    return _pixel_formats[u.first].unpackers[u.second].get_downscale() != factor;
+                }), candidates.end());
             }
+            pending.push_back({ r, std::move(candidates) });
         }
 
         //if you want more efficient data structure use std::unordered_set
         //with well-defined hash function
         std::set<request_mapping> results;
 
-        while (!requests.empty() && !_pixel_formats.empty())
+        while (!pending.empty())
         {
+            // How many of the pending requests each unpacker can supply, visited in registration order
+            std::map<unpacker_position, int> counts;
+            for (auto&& p : pending)
+                for (auto&& u : p.second)
+                    ++counts[u];
+
             auto max = 0;
             size_t best_size = 0;
-            auto best_pf = &_pixel_formats.front();
-            auto best_unpacker = &_pixel_formats.front().unpackers.front();
-            for (auto&& pf : _pixel_formats)
+            unpacker_position best{};
+            for (auto&& c : counts)
             {
-                // Speeds up algorithm by skipping obviously useless 4ccs
-                // if (std::none_of(begin(legal_fourccs), end(legal_fourccs), [&](const uint32_t fourcc) {return fourcc == pf.fourcc; })) continue;
-                for (auto&& unpacker : pf.unpackers)
+                auto size = _pixel_formats[c.first.first].unpackers[c.first.second].outputs.size();
+
+                // Here we check if the current pixel format / unpacker combination is better than the current best.
+                // We judge on two criteria. A: how many of the requested streams can we supply? B: how many total streams do we open?
+                // Optimally, we want to find a combination that supplies all the requested streams, and no additional streams.
+                if (
+                    c.second > max                  // If the current combination supplies more streams, it is better.
+                    || (c.second == max             // Alternatively, if it supplies the same number of streams,
+                        && size < best_size)        // but this combination opens fewer total streams, it is also better
+                    )
                 {
-                    auto count = static_cast<int>(std::count_if(begin(requests), end(requests),
-                        [&pf, &legal_fourccs, &unpacker](const std::shared_ptr<stream_profile_interface>& r)
-                    {
-                        // only count if the 4cc can be unpacked into the relevant stream/format
-                        // and also, the pixel format can be streamed in the requested dimensions/fps.
-                        return unpacker.satisfies(to_profile(r.get())) && legal_fourccs[r->get_stream_index()].count(pf.fourcc);
-                    }));
-
-                    // Here we check if the current pixel format / unpacker combination is better than the current best.
-                    // We judge on two criteria. A: how many of the requested streams can we supply? B: how many total streams do we open?
-                    // Optimally, we want to find a combination that supplies all the requested streams, and no additional streams.
-                    if (
-                        count > max                                 // If the current combination supplies more streams, it is better.
-                        || (count == max                            // Alternatively, if it supplies the same number of streams,
-                            && unpacker.outputs.size() < best_size) // but this combination opens fewer total streams, it is also better
-                        )
-                    {
-                        max = count;
-                        best_size = unpacker.outputs.size();
-                        best_pf = &pf;
-                        best_unpacker = &unpacker;
-                    }
+                    max = c.second;
+                    best_size = size;
+                    best = c.first;
                 }
             }
 
             if (max == 0) break;
 
-            requests.erase(std::remove_if(begin(requests), end(requests),
-                [best_unpacker, best_pf, &results, &legal_fourccs, this](const std::shared_ptr<stream_profile_interface>& r)
+            auto best_pf = &_pixel_formats[best.first];
+            auto best_unpacker = &best_pf->unpackers[best.second];
+            pending.erase(std::remove_if(begin(pending), end(pending),
+                [best, best_pf, best_unpacker, &results](const std::pair<std::shared_ptr<stream_profile_interface>, std::vector<unpacker_position>>& p)
             {
-                if (best_unpacker->satisfies(to_profile(r.get())) && legal_fourccs[r->get_stream_index()].count(best_pf->fourcc))
-                {
-                    auto request = dynamic_cast<const video_stream_profile*>(r.get());
+                if (std::find(p.second.begin(), p.second.end(), best) == p.second.end())
+                    return false;
 
-                    request_mapping mapping;
-                    mapping.unpacker = best_unpacker;
-                    mapping.pf = best_pf;
+                auto&& r = p.first;
+                auto request = dynamic_cast<const video_stream_profile*>(r.get());
 
-                    if (!request) {
+                request_mapping mapping;
+                mapping.unpacker = best_unpacker;
+                mapping.pf = best_pf;
 
-                        mapping.profile = { 0, 0, r->get_framerate(), best_pf->fourcc };
-                    }
-                    else
-                    {
-                        mapping.profile = { request->get_width(), request->get_height(), request->get_framerate(), best_pf->fourcc };
-                    }
+                if (!request) {
 
-                    results.insert(mapping);
+                    mapping.profile = { 0, 0, r->get_framerate(), best_pf->fourcc };
+                }
+                else
+                {
+                    // The device streams the native resolution the unpacker downscales from
+                    auto scale = static_cast<uint32_t>(best_unpacker->get_downscale());
+                    mapping.profile = { request->get_width() * scale, request->get_height() * scale, request->get_framerate(), best_pf->fourcc };
+                }
 
-                    auto it = results.find(mapping);
-                    if (it != results.end())
-                    {
-                        it->original_requests.push_back(r);
-                    }
+                results.insert(mapping);
 
-                    return true;
+                auto it = results.find(mapping);
+                if (it != results.end())
+                {
+                    it->original_requests.push_back(r);
                 }
-                return false;
-            }), end(requests));
+
+                return true;
+            }), end(pending));
         }
 
-        if (requests.empty()) return{ begin(results), end(results) };
+        if (pending.empty()) return{ begin(results), end(results) };
 
         throw invalid_value_exception("Subdevice unable to satisfy stream requests!");
     }
@@ -266,12 +336,30 @@ namespace librealsense
             native_pixel_format pf{};
             if (try_get_pf(p, pf))
             {
+                // Downscaled profiles take their intrinsics from the native profile of the same stream and format,
+                // the unpackers of which precede the downscaling ones
+                std::map<std::tuple<rs2_stream, int, rs2_format>, std::shared_ptr<video_stream_profile>> native;
                 for (auto&& unpacker : pf.unpackers)
                 {
+                    auto scale = unpacker.get_downscale();
+                    if (p.width % scale || p.height % scale) continue;
+
                     for (auto&& output : unpacker.outputs)
                     {
-                        auto profile = std::make_shared<video_stream_profile>(p);
-                        profile->set_dims(p.width, p.height);
+                        auto key = std::make_tuple(output.first.type, output.first.index, output.second);
+                        std::shared_ptr<video_stream_profile> profile;
+                        if (scale == 1)
+                        {
+                            profile = std::make_shared<video_stream_profile>(p);
+                            profile->set_dims(p.width, p.height);
+                            native[key] = profile;
+                        }
+                        else if (native.count(key))
+                        {
+                            profile = std::make_shared<downscaled_video_stream_profile>(p, native[key], scale);
+                        }
+                        else continue;
+
                         profile->set_stream_type(output.first.type);
                         profile->set_stream_index(output.first.index);
                         profile->set_format(output.second);
@@ -313,6 +401,21 @@ namespace librealsense
             LOG_WARNING(ss.str());
         }
 
+        // A downscaled profile the sensor also streams natively is left out, the native one is cheaper to unpack
+        std::set<std::tuple<rs2_stream, int, uint32_t, uint32_t, uint32_t, rs2_format>> native_modes;
+        for (auto&& profile : results)
+            if (!dynamic_cast<downscaled_video_stream_profile*>(profile.get()))
+                native_modes.insert(std::make_tuple(profile->get_stream_type(), profile->get_stream_index(), profile->get_width(), profile->get_height(), profile->get_framerate(), profile->get_format()));
+        for (auto it = results.begin(); it != results.end();)
+        {
+            auto&& profile = *it;
+            if (dynamic_cast<downscaled_video_stream_profile*>(profile.get()) &&
+                native_modes.count(std::make_tuple(profile->get_stream_type(), profile->get_stream_index(), profile->get_width(), profile->get_height(), profile->get_framerate(), profile->get_format())))
+                it = results.erase(it);
+            else
+                ++it;
+        }
+
         // Sort the results to make sure that the user will receive predictable deterministic output from the API
         stream_profiles res{ begin(results), end(results) };
         std::sort(res.begin(), res.end(), [](const std::shared_ptr<stream_profile_interface>& ap,
@@ -349,7 +452,10 @@ namespace librealsense
     {
         if (_pixel_formats.end() == std::find_if(_pixel_formats.begin(), _pixel_formats.end(),
             [&pf](const native_pixel_format& cur) { return cur.fourcc == pf.fourcc; }))
+        {
             _pixel_formats.push_back(pf);
+            _resolver_index = [this]() { return this->build_resolver_index(); };
+        }
         else
             throw invalid_value_exception(to_string()
                 << "Pixel format " << std::hex << std::setw(8) << std::setfill('0') << pf.fourcc
@@ -360,7 +466,57 @@ namespace librealsense
     {
         auto it = std::find_if(_pixel_formats.begin(), _pixel_formats.end(), [&pf](const native_pixel_format& cur) { return cur.fourcc == pf.fourcc; });
         if (it != _pixel_formats.end())
+        {
             _pixel_formats.erase(it);
+            _resolver_index = [this]() { return this->build_resolver_index(); };
+        }
+    }
+
+    // Sensors that unpack frames in bands share one pool, that lives while any of them is open
+    static std::shared_ptr<parallel_pool> acquire_unpack_pool()
+    {
+        static std::mutex mutex;
+        static std::weak_ptr<parallel_pool> shared;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto pool = shared.lock();
+        if (!pool)
+        {
+            // The thread delivering the frame unpacks bands as well
+            auto threads = std::thread::hardware_concurrency();
+            pool = std::make_shared<parallel_pool>(threads > 2 ? threads - 1 : 1);
+            shared = pool;
+        }
+        return pool;
+    }
+
+    // Outputs of a native frame are gathered in fixed arrays on the stack of the frame callback
+    const size_t max_unpacker_outputs = 4;
+
+    int get_unpack_band_rows(const request_mapping& mode)
+    {
+        const int band_bytes = 256 * 1024; // keeps the source and destination rows of a band in the core's L2
+
+        auto block = mode.unpacker->split_pixels;
+        if (block <= 0 || mode.unpacker->outputs.size() > max_unpacker_outputs)
+            return 0;
+
+        auto width = static_cast<int>(mode.profile.width);
+        auto height = static_cast<int>(mode.profile.height);
+        if (width <= 0 || (width * height) % block)
+            return 0;
+
+        auto row_bytes = width * static_cast<int>(mode.pf->bytes_per_pixel);
+        for (auto&& output : mode.unpacker->outputs)
+            row_bytes += width * get_image_bpp(output.second) / 8;
+
+        // Every band, the last one holding the remaining rows included, has to be a whole number of the unpacker's blocks
+        auto a = width, b = block;
+        while (b) { auto r = a % b; a = b; b = r; }
+        auto step = block / a;
+
+        auto rows = std::max(step, band_bytes / row_bytes / step * step);
+        return rows < height ? rows : 0;
     }
 
     void uvc_sensor::open(const stream_profiles& requests)
@@ -377,17 +533,48 @@ namespace librealsense
         auto mapping = resolve_requests(requests);
 
         auto timestamp_reader = _timestamp_reader.get();
+        auto buffers = _capture_buffers;
+        auto memory = static_cast<platform::capture_memory>(_capture_memory);
+        // A queued frame holds its capture buffer, leave one to capture into and one to the frame being unpacked
+        auto queue_size = _unpack_queue_size ? std::max(1, std::min(_unpack_queue_size, buffers - 2)) : 0;
+        auto queue_policy = static_cast<queue_overflow_policy>(_unpack_queue_policy);
 
         std::vector<platform::stream_profile> commited;
 
         for (auto&& mode : mapping)
         {
+            // Frames of pass-through formats are handed out in the backend buffers while they last
+            auto zero_copy = _zero_copy && !mode.requires_processing();
+            auto held_buffers = std::make_shared<std::atomic<int>>(0);
+            // The buffers the backend actually granted, set once the profile is committed and before streaming starts
+            auto granted_buffers = std::make_shared<int>(buffers);
+            // Large frames are unpacked in bands of rows on a pool, to cut the latency of the unpack
+            auto band_rows = _parallel_unpack ? get_unpack_band_rows(mode) : 0;
+            auto pool = band_rows ? acquire_unpack_pool() : nullptr;
+
+            // The request each output of the unpacker is delivered to, if any
+            auto outputs = mode.unpacker->outputs.size();
+            if (outputs > max_unpacker_outputs)
+                throw invalid_value_exception(to_string() << "Unpacker with " << outputs << " outputs is not supported!");
+            std::array<std::shared_ptr<stream_profile_interface>, max_unpacker_outputs> output_requests;
+            for (size_t i = 0; i < outputs; ++i)
+            {
+                auto&& output = mode.unpacker->outputs[i];
+                for (auto&& original_prof : mode.original_requests)
+                {
+                    if (original_prof->get_format() == output.second &&
+                        original_prof->get_stream_type() == output.first.type &&
+                        original_prof->get_stream_index() == output.first.index)
+                    {
+                        output_requests[i] = original_prof;
+                    }
+                }
+            }
+
             try
             {
-                _device->probe_and_commit(mode.profile,
-                [this, mode, timestamp_reader, requests](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                auto process = [this, mode, timestamp_reader, zero_copy, held_buffers, granted_buffers, queue_size, band_rows, pool, outputs, output_requests](platform::frame_object f, std::function<void()> continuation, rs2_time_t system_time) mutable
                 {
-                    auto system_time = environment::get_instance().get_time_service()->get_time();
                     if (!this->is_streaming())
                     {
                         LOG_WARNING("Frame received with streaming inactive,"
@@ -397,7 +584,12 @@ namespace librealsense
                         return;
                     }
 
-                    frame_continuation release_and_enqueue(continuation, f.pixels);
+                    // Fall back to copying once the user would hold all the buffers but those the unpack queue may fill
+                    // and the one the backend keeps capturing into
+                    auto requires_processing = !zero_copy || held_buffers->load() + queue_size + 1 >= *granted_buffers;
+                    frame_continuation release_and_enqueue = requires_processing ? frame_continuation(std::move(continuation), f.pixels) :
+                        frame_continuation([continuation, held_buffers]() { --*held_buffers; continuation(); }, f.pixels);
+                    if (!requires_processing) ++*held_buffers;
 
                     // Ignore any frames which appear corrupted or invalid
                     // Determine the timestamp for this frame
@@ -405,50 +597,42 @@ namespace librealsense
                     auto timestamp_domain = timestamp_reader->get_frame_timestamp_domain(mode, f);
                     auto frame_counter = timestamp_reader->get_frame_counter(mode, f);
 
-                    auto requires_processing = mode.requires_processing();
-
                     auto width = mode.profile.width;
                     auto height = mode.profile.height;
+                    // Downscaling unpackers are fed the native frame and produce smaller ones
+                    auto out_width = width / mode.unpacker->get_downscale();
+                    auto out_height = height / mode.unpacker->get_downscale();
+
+                    byte * dest[max_unpacker_outputs];
+                    frame_holder refs[max_unpacker_outputs];
 
-                    std::vector<byte *> dest;
-                    std::vector<frame_holder> refs;
+                    // All outputs of the same native frame share one metadata block
+                    frame_additional_data additional_data(timestamp,
+                        frame_counter,
+                        system_time,
+                        static_cast<uint8_t>(f.metadata_size),
+                        (const uint8_t*)f.metadata,
+                        f.backend_time);
 
                     auto&& unpacker = *mode.unpacker;
-                    for (auto&& output : unpacker.outputs)
+                    for (size_t i = 0; i < outputs; ++i)
                     {
+                        auto&& output = unpacker.outputs[i];
                         LOG_DEBUG("FrameAccepted," << librealsense::get_string(output.first.type) << "," << std::dec << frame_counter
                             << output.first.index << "," << frame_counter
                             << ",Arrived," << std::fixed << f.backend_time << " " << std::fixed << system_time<<" diff - "<< system_time- f.backend_time << " "
                             << ",TS," << std::fixed << timestamp << ",TS_Domain," << rs2_timestamp_domain_to_string(timestamp_domain));
 
-                        std::shared_ptr<stream_profile_interface> request = nullptr;
-                        for (auto&& original_prof : mode.original_requests)
-                        {
-                            if (original_prof->get_format() == output.second &&
-                                original_prof->get_stream_type() == output.first.type &&
-                                original_prof->get_stream_index() == output.first.index)
-                            {
-                                request = original_prof;
-                            }
-                        }
-
                         auto bpp = get_image_bpp(output.second);
-                        frame_additional_data additional_data(timestamp,
-                            frame_counter,
-                            system_time,
-                            static_cast<uint8_t>(f.metadata_size),
-                            (const uint8_t*)f.metadata,
-                            f.backend_time);
-
-                        frame_holder frame = _source.alloc_frame(stream_to_frame_types(output.first.type), width * height * bpp / 8, additional_data, requires_processing);
+                        frame_holder frame = _source.alloc_frame(stream_to_frame_types(output.first.type), out_width * out_height * bpp / 8, additional_data, requires_processing);
                         if (frame.frame)
                         {
                             auto video = (video_frame*)frame.frame;
-                            video->assign(width, height, width * bpp / 8, bpp);
+                            video->assign(out_width, out_height, get_image_stride(out_width, output.second), bpp);
                             video->set_timestamp_domain(timestamp_domain);
-                            dest.push_back(const_cast<byte*>(video->get_frame_data()));
-                            frame->set_stream(request);
-                            refs.push_back(std::move(frame));
+                            dest[i] = const_cast<byte*>(video->get_frame_data());
+                            frame->set_stream(output_requests[i]);
+                            refs[i] = std::move(frame);
                         }
                         else
                         {
@@ -461,14 +645,39 @@ namespace librealsense
                     }
 
                     // Unpack the frame
-                    if (requires_processing && (dest.size() > 0))
+                    if (requires_processing && outputs > 0)
                     {
-                        unpacker.unpack(dest.data(), reinterpret_cast<const byte *>(f.pixels), width * height);
+                        TRACE_STREAM_EVENT(TRACE_UNPACK_BEGIN, unpacker.outputs.front().first.type, unpacker.outputs.front().first.index, frame_counter);
+                        auto source = reinterpret_cast<const byte *>(f.pixels);
+                        if (band_rows)
+                        {
+                            auto unpack_band = [&](int band)
+                            {
+                                auto first_row = band * band_rows;
+                                auto rows = std::min(band_rows, static_cast<int>(height) - first_row);
+                                auto first_pixel = first_row * width;
+
+                                byte * band_dest[max_unpacker_outputs];
+                                for (size_t i = 0; i < outputs; ++i)
+                                    band_dest[i] = dest[i] + first_pixel * get_image_bpp(unpacker.outputs[i].second) / 8;
+                                unpacker.unpack(band_dest, source + first_pixel * mode.pf->bytes_per_pixel, rows * width);
+                            };
+                            pool->parallel_for((height + band_rows - 1) / band_rows, unpack_band);
+                        }
+                        else
+                        {
+                            unpacker.unpack_image(dest, source, width, height);
+                        }
+                        TRACE_STREAM_EVENT(TRACE_UNPACK_END, unpacker.outputs.front().first.type, unpacker.outputs.front().first.index, frame_counter);
+
+                        // The frame is copied out, hand the capture buffer back before the callbacks run
+                        release_and_enqueue();
                     }
 
                     // If any frame callbacks were specified, dispatch them now
-                    for (auto&& pref : refs)
+                    for (size_t i = 0; i < outputs; ++i)
                     {
+                        auto&& pref = refs[i];
                         if (!requires_processing)
                         {
                             pref->attach_continuation(std::move(release_and_enqueue));
@@ -484,7 +693,40 @@ namespace librealsense
                         if (pref->get_stream().get())
                             _source.invoke_callback(std::move(pref));
                     }
-                });
+                };
+
+                // With an unpack queue, the capture thread only hands the buffer over and goes back to capturing
+                std::shared_ptr<bounded_worker<captured_frame>> worker;
+                if (queue_size)
+                {
+                    worker = std::make_shared<bounded_worker<captured_frame>>(queue_size, queue_policy,
+                        [process](captured_frame& item) mutable
+                        {
+                            try
+                            {
+                                process(item.frame, std::move(item.continuation), item.system_time);
+                            }
+                            catch (const std::exception& ex)
+                            {
+                                LOG_ERROR("Failed to unpack frame: " << ex.what());
+                            }
+                        },
+                        [](captured_frame& item) { item.continuation(); });
+                    _unpack_workers.push_back(worker);
+                }
+
+                // The frame counter is only parsed once the frame is processed, so the dequeue is traced without it
+                auto traced_stream = mode.unpacker->outputs.front().first;
+                *granted_buffers = _device->probe_and_commit(mode.profile,
+                [process, worker, traced_stream](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                {
+                    TRACE_STREAM_EVENT(TRACE_BACKEND_DEQUEUE, traced_stream.type, traced_stream.index, 0);
+                    auto system_time = environment::get_instance().get_time_service()->get_time();
+                    if (worker)
+                        worker->invoke({ f, std::move(continuation), system_time });
+                    else
+                        process(f, std::move(continuation), system_time);
+                }, buffers, memory);
             }
             catch(...)
             {
@@ -492,6 +734,7 @@ namespace librealsense
                 {
                     _device->close(commited_profile);
                 }
+                _unpack_workers.clear();
                 throw;
             }
             commited.push_back(mode.profile);
@@ -539,6 +782,7 @@ namespace librealsense
         {
             _device->close(profile);
         }
+        _unpack_workers.clear();
         reset_streaming();
         _power.reset();
         _is_opened = false;
@@ -572,6 +816,8 @@ namespace librealsense
 
         _is_streaming = false;
         _device->stop_callbacks();
+        for (auto&& worker : _unpack_workers)
+            worker->flush();
         raise_on_before_streaming_changes(false);
     }
 
@@ -659,6 +905,13 @@ namespace librealsense
         }
     }
 
+    void uvc_sensor::set_zero_copy_default(bool zero_copy)
+    {
+        _zero_copy = zero_copy;
+        register_option(RS2_OPTION_ZERO_COPY, std::make_shared<ptr_option<bool>>(false, true, true, zero_copy, &_zero_copy,
+            "Hand out frames of pass-through formats, such as Z16, Y8 and YUYV, in the capture buffers instead of copying them. Takes effect on the next open"));
+    }
+
     void uvc_sensor::register_pu(rs2_option id)
     {
         register_option(id, std::make_shared<uvc_pu_option>(*this, id));
@@ -686,11 +939,11 @@ namespace librealsense
 
     void sensor_base::register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const
     {
-        if (_metadata_parsers.get()->end() != _metadata_parsers.get()->find(metadata))
+        if (_metadata_parsers->contains(metadata))
             throw invalid_value_exception( to_string() << "Metadata attribute parser for " << rs2_frame_metadata_to_string(metadata)
                                            <<  " is already defined");
 
-        _metadata_parsers.get()->insert(std::pair<rs2_frame_metadata_value, std::shared_ptr<md_attribute_parser_base>>(metadata, metadata_parser));
+        _metadata_parsers->set(metadata, metadata_parser);
     }
 
     hid_sensor::hid_sensor(std::shared_ptr<platform::hid_device> hid_device, std::unique_ptr<frame_timestamp_reader> hid_iio_timestamp_reader,
@@ -888,6 +1141,7 @@ namespace librealsense
             // Determine the timestamp for this HID frame
             auto timestamp = timestamp_reader->get_frame_timestamp(mode, sensor_data.fo);
             auto frame_counter = timestamp_reader->get_frame_counter(mode, sensor_data.fo);
+            TRACE_STREAM_EVENT(TRACE_BACKEND_DEQUEUE, request->get_stream_type(), request->get_stream_index(), frame_counter);
 
             frame_additional_data additional_data{};
 
@@ -1004,5 +1258,41 @@ namespace librealsense
           _timestamp_reader(std::move(timestamp_reader))
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP,     make_additional_data_parser(&frame_additional_data::backend_timestamp));
+
+        set_zero_copy_default(true);
+
+        register_option(RS2_OPTION_CAPTURE_BUFFERS, std::make_shared<ptr_option<int>>(2, 32, 1, DEFAULT_V4L2_FRAME_BUFFERS, &_capture_buffers,
+            "Number of buffers the backend captures frames into. More buffers absorb slower consumers, fewer reduce latency. Takes effect on the next open"));
+
+        auto capture_memory = std::make_shared<ptr_option<int>>(platform::CAPTURE_MEMORY_AUTO, platform::CAPTURE_MEMORY_COUNT - 1, 1,
+            platform::CAPTURE_MEMORY_AUTO, &_capture_memory,
+            "Type of memory the backend captures frames into, where the backend supports a choice. Takes effect on the next open");
+        capture_memory->set_description(platform::CAPTURE_MEMORY_AUTO, "Auto");
+        capture_memory->set_description(platform::CAPTURE_MEMORY_MMAP, "Memory Mapped");
+        capture_memory->set_description(platform::CAPTURE_MEMORY_USERPTR, "User Pointer");
+        capture_memory->set_description(platform::CAPTURE_MEMORY_DMABUF, "DMA Buffer");
+        register_option(RS2_OPTION_CAPTURE_MEMORY, capture_memory);
+
+        register_option(RS2_OPTION_PARALLEL_UNPACK, std::make_shared<ptr_option<bool>>(false, true, true, false, &_parallel_unpack,
+            "Unpack large frames in bands of rows on a thread pool shared by all sensors, to cut the unpack latency. Takes effect on the next open"));
+
+        register_option(RS2_OPTION_MAX_DOWNSCALE, std::make_shared<ptr_option<int>>(1, 3, 1, 1, &_max_downscale,
+            "Largest factor a colour resolution the sensor also captures natively may be downscaled by from a larger capture while unpacking, "
+            "1 to capture it natively. Takes effect on the next open"));
+
+#ifndef RS2_USE_LIBUVC_BACKEND
+        // Queued frames stay in their capture buffers, which the libuvc backend reuses as soon as the frame callback returns
+        register_option(RS2_OPTION_UNPACK_QUEUE_SIZE, std::make_shared<ptr_option<int>>(0, 30, 1, 0, &_unpack_queue_size,
+            "Number of frames queued between the capture thread and a thread that unpacks them, 0 to unpack on the capture thread. "
+            "Limited to two less than the capture buffers. Takes effect on the next open"));
+
+        auto queue_policy = std::make_shared<ptr_option<int>>(QUEUE_DROP_OLDEST, QUEUE_OVERFLOW_POLICY_COUNT - 1, 1,
+            QUEUE_DROP_OLDEST, &_unpack_queue_policy,
+            "What happens to a frame that arrives while the unpack queue is full. Takes effect on the next open");
+        queue_policy->set_description(QUEUE_DROP_OLDEST, "Drop Oldest");
+        queue_policy->set_description(QUEUE_DROP_NEWEST, "Drop Newest");
+        queue_policy->set_description(QUEUE_BLOCK, "Block");
+        register_option(RS2_OPTION_UNPACK_QUEUE_POLICY, queue_policy);
+#endif
     }
 }
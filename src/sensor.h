@@ -15,6 +15,9 @@
 #include <memory>
 #include <vector>
 #include <unordered_set>
+#include <map>
+#include <set>
+#include <tuple>
 #include <limits.h>
 #include <atomic>
 #include <functional>
@@ -50,6 +53,13 @@ namespace librealsense
         std::shared_ptr<notifications_processor> get_notifications_processor();
         virtual frame_callback_ptr get_frames_callback() const override;
         virtual void set_frames_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
+        rs2_frame_stats get_frame_stats() const override { return _source.get_statistics(); }
+        rs2_latency_stats get_latency_stats(rs2_stream stream, int index, rs2_latency_type type) const override
+        {
+            return _source.get_latency_statistics(stream, index, type);
+        }
+        void reset_latency_stats() override { _source.reset_latency_statistics(); }
 
         bool is_streaming() const override
         {
@@ -100,9 +110,22 @@ namespace librealsense
 
         frame_source _source;
         device* _owner;
+        int _max_downscale = 1; // largest factor resolve_requests downscales a resolution the sensor also streams natively by
 
     private:
+        // Lookup tables of resolve_requests, built once from the stream profiles and the registered pixel formats
+        struct resolver_index
+        {
+            // Native fourccs, with the factor their unpackers downscale by, that stream each width, height and fps
+            std::map<std::tuple<uint32_t, uint32_t, uint32_t>, std::set<std::pair<uint32_t, int>>> fourccs;
+            // Pixel format and unpacker positions, in registration order, of the unpackers producing each stream, index and format
+            std::map<std::tuple<rs2_stream, int, rs2_format>, std::vector<std::pair<size_t, size_t>>> unpackers;
+        };
+
+        resolver_index build_resolver_index();
+
         lazy<stream_profiles> _profiles;
+        lazy<resolver_index> _resolver_index;
         stream_profiles _active_profiles;
         std::vector<native_pixel_format> _pixel_formats;
         signal<sensor_base, bool> on_before_streaming_changes;
@@ -170,6 +193,9 @@ namespace librealsense
         uint32_t fps_to_sampling_frequency(rs2_stream stream, uint32_t fps) const;
     };
 
+    // Number of rows in each band of a banded unpack, or 0 when the frame is better unpacked in one go
+    int get_unpack_band_rows(const request_mapping& mode);
+
     class uvc_sensor : public sensor_base,
                        public roi_sensor_interface
     {
@@ -201,6 +227,9 @@ namespace librealsense
         void register_pu(rs2_option id);
         void try_register_pu(rs2_option id);
 
+        // Sensors whose applications are used to owning the frames they get can have zero-copy off unless asked for
+        void set_zero_copy_default(bool zero_copy);
+
         void start(frame_callback_ptr callback) override;
 
         void stop() override;
@@ -246,5 +275,19 @@ namespace librealsense
         std::unique_ptr<power> _power;
         std::unique_ptr<frame_timestamp_reader> _timestamp_reader;
         std::shared_ptr<region_of_interest_method> _roi_method = nullptr;
+        bool _zero_copy = true;
+        int _capture_buffers = DEFAULT_V4L2_FRAME_BUFFERS;
+        int _capture_memory = platform::CAPTURE_MEMORY_AUTO;
+        bool _parallel_unpack = false;
+        int _unpack_queue_size = 0;
+        int _unpack_queue_policy = QUEUE_DROP_OLDEST;
+
+        struct captured_frame
+        {
+            platform::frame_object frame;
+            std::function<void()> continuation; // re-queues the capture buffer
+            rs2_time_t system_time;
+        };
+        std::vector<std::shared_ptr<bounded_worker<captured_frame>>> _unpack_workers;
     };
 }
@@ -4,6 +4,7 @@
 #include "source.h"
 #include "option.h"
 #include "environment.h"
+#include "trace.h"
 
 namespace librealsense
 {
@@ -38,12 +39,13 @@ namespace librealsense
 
     std::shared_ptr<option> frame_source::get_published_size_option()
     {
-        return std::make_shared<frame_queue_size>(&_max_publish_list_size, option_range{ 0, 32, 1, 16 });
+        return std::make_shared<frame_queue_size>(&_max_publish_list_size, option_range{ 0, RS2_USER_QUEUE_SIZE, 1, 16 });
     }
 
     frame_source::frame_source(uint32_t max_publish_list_size)
             : _callback(nullptr, [](rs2_frame_callback*) {}),
               _max_publish_list_size(max_publish_list_size),
+              _stats(std::make_shared<frame_statistics>()),
               _ts(environment::get_instance().get_time_service())
     {}
 
@@ -61,7 +63,7 @@ namespace librealsense
 
         for (auto type : supported)
         {
-            _archive[type] = make_archive(type, &_max_publish_list_size, _ts, metadata_parsers);
+            _archive[type] = make_archive(type, &_max_publish_list_size, _ts, metadata_parsers, _allocator, _stats);
         }
     }
 
@@ -96,6 +98,12 @@ namespace librealsense
         }
     }
 
+    void frame_source::set_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        _allocator = std::move(allocator);
+    }
+
     void frame_source::set_callback(frame_callback_ptr callback)
     {
         std::lock_guard<std::mutex> lock(_callback_mutex);
@@ -114,12 +122,25 @@ namespace librealsense
             auto callback = frame.frame->get_owner()->begin_callback();
             try
             {
-                frame->log_callback_start(_ts ? _ts->get_time() : 0);
+                auto callback_started = get_time();
+                frame->log_callback_start(callback_started);
+                TRACE_FRAME_EVENT(TRACE_PUBLISH, frame.frame);
                 if (_callback)
                 {
+                    latency_statistics::stream_latency* latency = nullptr;
+                    if (auto stream = frame->get_stream())
+                    {
+                        latency = &_latency.get(stream->get_stream_type(), stream->get_stream_index());
+                        latency->on_callback_start(*frame, callback_started);
+                    }
+
                     frame_interface* ref = nullptr;
                     std::swap(frame.frame, ref);
+                    TRACE_SPAN_BEGIN(span, TRACE_CALLBACK_BEGIN, ref);
                     _callback->on_frame((rs2_frame*)ref);
+                    TRACE_SPAN_END(span, TRACE_CALLBACK_END);
+
+                    if (latency) latency->on_callback_end(callback_started, get_time());
                 }
             }
             catch(...)
@@ -40,6 +40,13 @@ namespace librealsense
 
         void set_sensor(std::shared_ptr<sensor_interface> s);
 
+        void set_allocator(frame_allocator_ptr allocator);
+
+        rs2_frame_stats get_statistics() const { return _stats->get(); }
+
+        rs2_latency_stats get_latency_statistics(rs2_stream stream, int index, rs2_latency_type type) const { return _latency.get_stats(stream, index, type); }
+        void reset_latency_statistics() { _latency.reset(); }
+
     private:
         friend class syncer_process_unit;
 
@@ -49,6 +56,9 @@ namespace librealsense
 
         std::atomic<uint32_t> _max_publish_list_size;
         frame_callback_ptr _callback;
+        frame_allocator_ptr _allocator;
+        std::shared_ptr<frame_statistics> _stats;
+        mutable latency_statistics _latency;
         std::shared_ptr<platform::time_service> _ts;
     };
 }
@@ -140,6 +140,47 @@ namespace librealsense
         uint32_t _width, _height;
     };
 
+    // Profile of frames an unpacker box-filters down from a native resolution of the sensor.
+    // Its intrinsics are derived from those of the native resolution, whatever the owning device assigns
+    class downscaled_video_stream_profile : public video_stream_profile
+    {
+    public:
+        downscaled_video_stream_profile(platform::stream_profile sp, std::shared_ptr<video_stream_profile_interface> native, int scale)
+            : video_stream_profile(std::move(sp)), _native(std::move(native)), _scale(scale)
+        {
+            set_dims(_native->get_width() / scale, _native->get_height() / scale);
+        }
+
+        rs2_intrinsics get_intrinsics() const override { return downscale(_native->get_intrinsics(), _scale); }
+
+        std::shared_ptr<stream_profile_interface> clone() const override
+        {
+            auto res = video_stream_profile::clone();
+            auto native = _native;
+            auto scale = _scale;
+            dynamic_cast<video_stream_profile_interface*>(res.get())->set_intrinsics([native, scale]() { return downscale(native->get_intrinsics(), scale); });
+            return res;
+        }
+
+        int get_scale() const { return _scale; }
+
+    private:
+        // Each output pixel covers scale x scale native pixels, its centre lies in the middle of them
+        static rs2_intrinsics downscale(rs2_intrinsics intrinsics, int scale)
+        {
+            intrinsics.width /= scale;
+            intrinsics.height /= scale;
+            intrinsics.fx /= scale;
+            intrinsics.fy /= scale;
+            intrinsics.ppx = (intrinsics.ppx + 0.5f) / scale - 0.5f;
+            intrinsics.ppy = (intrinsics.ppy + 0.5f) / scale - 0.5f;
+            return intrinsics;
+        }
+
+        std::shared_ptr<video_stream_profile_interface> _native;
+        int _scale;
+    };
+
 
     class motion_stream_profile : public motion_stream_profile_interface, public stream_profile_base, public extension_snapshot
     {
@@ -3,6 +3,7 @@
 
 #include "proc/synthetic-stream.h"
 #include "sync.h"
+#include "trace.h"
 
 namespace librealsense
 {
@@ -74,9 +75,10 @@ namespace librealsense
 
     void identity_matcher::dispatch(frame_holder f, syncronization_environment env)
     {
-        std::stringstream s;
-        s <<_name<<"--> "<< f->get_stream()->get_stream_type() << " " << f->get_frame_number() << ", "<<std::fixed<< f->get_frame_timestamp()<<"\n";
-        LOG_DEBUG(s.str());
+        LOG_DEBUG(log_format([&](std::ostream& s)
+        {
+            s <<_name<<"--> "<< f->get_stream()->get_stream_type() << " " << f->get_frame_number() << ", "<<std::fixed<< f->get_frame_timestamp()<<"\n";
+        }));
 
         sync(std::move(f), env);
     }
@@ -94,17 +96,16 @@ namespace librealsense
         return s.str();
     }
 
+    const size_t composite_matcher::no_matcher;
+
     composite_matcher::composite_matcher(std::vector<std::shared_ptr<matcher>> matchers, std::string name)
     {
         for (auto&& matcher : matchers)
         {
+            auto index = add_matcher(matcher);
             for (auto&& stream : matcher->get_streams())
             {
-                matcher->set_callback([&](frame_holder f, syncronization_environment env)
-                {
-                    sync(std::move(f), env);
-                });
-                _matchers[stream] = matcher;
+                set_matcher_index(stream, index);
                 _streams_id.push_back(stream);
             }
             for (auto&& stream : matcher->get_streams_types())
@@ -116,23 +117,77 @@ namespace librealsense
         _name = create_composite_name(matchers, name);
     }
 
+    size_t composite_matcher::add_matcher(std::shared_ptr<matcher> m)
+    {
+        m->set_callback([this](frame_holder f, syncronization_environment env)
+        {
+            sync(std::move(f), env);
+        });
+
+        _matchers.push_back(m);
+        _frames_queue.emplace_back(new single_consumer_queue<frame_holder>());
+        _frames_queued.push_back(false);
+        _next_expected.push_back(0);
+        _next_expected_domain.push_back(RS2_TIMESTAMP_DOMAIN_COUNT);
+        return _matchers.size() - 1;
+    }
+
+    size_t composite_matcher::get_matcher_index(stream_id stream) const
+    {
+        for (auto&& s : _stream_matchers)
+        {
+            if (s.first == stream)
+                return s.second;
+        }
+        return no_matcher;
+    }
+
+    void composite_matcher::set_matcher_index(stream_id stream, size_t index)
+    {
+        for (auto&& s : _stream_matchers)
+        {
+            if (s.first == stream)
+            {
+                s.second = index;
+                return;
+            }
+        }
+        _stream_matchers.emplace_back(stream, index);
+    }
+
+    single_consumer_queue<frame_holder>& composite_matcher::get_frames_queue(size_t index)
+    {
+        _frames_queued[index] = true;
+        return *_frames_queue[index];
+    }
+
+    void composite_matcher::remove_frames_queue(size_t index)
+    {
+        _frames_queue[index]->clear();
+        _frames_queue[index]->start();
+        _frames_queued[index] = false;
+    }
+
     void composite_matcher::dispatch(frame_holder f, syncronization_environment env)
     {
-        std::stringstream s;
-        s <<"DISPATCH "<<_name<<"--> "<< f->get_stream()->get_stream_type() << " " << f->get_frame_number() << ", "<<std::fixed<< f->get_frame_timestamp()<<"\n";
-        LOG_DEBUG(s.str());
+        LOG_DEBUG(log_format([&](std::ostream& s)
+        {
+            s <<"DISPATCH "<<_name<<"--> "<< f->get_stream()->get_stream_type() << " " << f->get_frame_number() << ", "<<std::fixed<< f->get_frame_timestamp()<<"\n";
+        }));
 
         clean_inactive_streams(f);
-        auto matcher = find_matcher(f);
-        update_last_arrived(f, matcher.get());
+        auto index = find_matcher(f);
+        update_last_arrived(f, index);
+        // Matchers stay in _matchers once added, so the pointer outlives a new matcher added while dispatching
+        auto matcher = _matchers[index].get();
         matcher->dispatch(std::move(f), env);
     }
 
-    std::shared_ptr<matcher> composite_matcher::find_matcher(const frame_holder& frame)
+    size_t composite_matcher::find_matcher(const frame_holder& frame)
     {
-        std::shared_ptr<matcher> matcher;
         auto stream_id = frame.frame->get_stream()->get_unique_id();
         auto stream_type = frame.frame->get_stream()->get_stream_type();
+        auto index = get_matcher_index(stream_id);
 
         auto sensor = frame.frame->get_sensor().get(); //TODO: Potential deadlock if get_sensor() gets a hold of the last reference of that sensor
 
@@ -153,24 +208,19 @@ namespace librealsense
             if (dev)
             {
                 dev_exist = true;
-                matcher = _matchers[stream_id];
-                if (!matcher)
+                if (index == no_matcher)
                 {
-                    matcher = dev->create_matcher(frame);
-
-
-                    matcher->set_callback([&](frame_holder f, syncronization_environment env)
-                    {
-                        sync(std::move(f), env);
-                    });
+                    auto matcher = dev->create_matcher(frame);
+                    index = add_matcher(matcher);
 
                     for (auto stream : matcher->get_streams())
                     {
-                        if (_matchers[stream])
+                        auto previous = get_matcher_index(stream);
+                        if (previous != no_matcher)
                         {
-                            _frames_queue.erase(_matchers[stream].get());
+                            remove_frames_queue(previous);
                         }
-                        _matchers[stream] = matcher;
+                        set_matcher_index(stream, index);
                         _streams_id.push_back(stream);
 
                     }
@@ -185,53 +235,46 @@ namespace librealsense
                     }
                 }
 
-                else if(!matcher->get_active())
+                else if(!_matchers[index]->get_active())
                 {
 
-                     matcher->set_active(true);
-                     _frames_queue[matcher.get()].start();
+                     _matchers[index]->set_active(true);
+                     get_frames_queue(index).start();
                 }
             }
         }
 
         if(!dev_exist)
         {
-            matcher = _matchers[stream_id];
             // We don't know what device this frame came from, so just store it under device NULL with ID matcher
-            if (!matcher)
+            if (index == no_matcher)
             {
-                if (_matchers[stream_id])
-                {
-                    _frames_queue.erase(_matchers[stream_id].get());
-                }
-                 _matchers[stream_id] = std::make_shared<identity_matcher>(stream_id, stream_type);
+                index = add_matcher(std::make_shared<identity_matcher>(stream_id, stream_type));
+                set_matcher_index(stream_id, index);
                 _streams_id.push_back(stream_id);
                 _streams_type.push_back(stream_type);
-                matcher = _matchers[stream_id];
-
-                matcher->set_callback([&](frame_holder f, syncronization_environment env)
-                {
-                    sync(std::move(f), env);
-                });
             }
         }
-        return matcher;
+        return index;
     }
 
     void composite_matcher::sync(frame_holder f, syncronization_environment env)
     {
-        std::stringstream s;
-        s <<"SYNC "<<_name<<"--> "<< f->get_stream()->get_stream_type() << " " << f->get_frame_number() << ", "<<std::fixed<< f->get_frame_timestamp()<<"\n";
-        LOG_DEBUG(s.str());
+        TRACE_FRAME_EVENT(TRACE_SYNC_ENQUEUE, f.frame);
+        LOG_DEBUG(log_format([&](std::ostream& s)
+        {
+            s <<"SYNC "<<_name<<"--> "<< f->get_stream()->get_stream_type() << " " << f->get_frame_number() << ", "<<std::fixed<< f->get_frame_timestamp()<<"\n";
+        }));
 
-        update_next_expected(f);
         auto matcher = find_matcher(f);
-        _frames_queue[matcher.get()].enqueue(std::move(f));
+        update_next_expected(f, matcher);
+        get_frames_queue(matcher).enqueue(std::move(f));
 
-        std::vector<frame_holder*> frames_arrived;
-        std::vector<librealsense::matcher*> frames_arrived_matchers;
-        std::vector<librealsense::matcher*> synced_frames;
-        std::vector<librealsense::matcher*> missing_streams;
+        auto& frames_arrived = _frames_arrived;
+        auto& frames_arrived_matchers = _frames_arrived_matchers;
+        auto& synced_frames = _synced_frames;
+        auto& missing_streams = _missing_streams;
+        auto synced = false;
 
         do
         {
@@ -243,17 +286,20 @@ namespace librealsense
             frames_arrived.clear();
 
 
-            for (auto s = _frames_queue.begin(); s != _frames_queue.end(); s++)
+            for (size_t i = 0; i < _frames_queue.size(); i++)
             {
+                if (!_frames_queued[i])
+                    continue;
+
                 frame_holder* f;
-                if (s->second.peek(&f))
+                if (_frames_queue[i]->peek(&f))
                 {
                     frames_arrived.push_back(f);
-                    frames_arrived_matchers.push_back(s->first);
+                    frames_arrived_matchers.push_back(i);
                 }
                 else
                 {
-                    missing_streams.push_back(s->first);
+                    missing_streams.push_back(i);
                 }
             }
 
@@ -267,7 +313,7 @@ namespace librealsense
                 synced_frames.push_back(frames_arrived_matchers[0]);
             }
 
-            for (auto i = 1; i < frames_arrived.size(); i++)
+            for (size_t i = 1; i < frames_arrived.size(); i++)
             {
                 if (are_equivalent(*curr_sync, *frames_arrived[i]))
                 {
@@ -297,17 +343,19 @@ namespace librealsense
                     }
                     else
                     {
-                        std::stringstream s;
-                        s << "skipped missing stream: " << _name<<" ";
-                        for (auto&& stream : i->get_streams())
-                            s << stream;
-
-                        LOG_DEBUG(s.str());
+                        LOG_DEBUG(log_format([&](std::ostream& s)
+                        {
+                            s << "skipped missing stream: " << _name<<" ";
+                            for (auto&& stream : _matchers[i]->get_streams())
+                                s << stream;
+                        }));
                     }
                 }
             }
 
-            if (synced_frames.size())
+            // The callback may sync again through a parent matcher, so the scratch buffers are not used past it
+            synced = synced_frames.size() > 0;
+            if (synced)
             {
                 std::vector<frame_holder> match;
                 match.reserve(synced_frames.size());
@@ -315,7 +363,7 @@ namespace librealsense
                 for (auto index : synced_frames)
                 {
                     frame_holder frame;
-                    _frames_queue[index].dequeue(&frame);
+                    _frames_queue[index]->dequeue(&frame);
 
                     match.push_back(std::move(frame));
                 }
@@ -326,37 +374,42 @@ namespace librealsense
                 });
 
 
-                std::stringstream s;
-                s<<"MATCHED: "<<_name;
-                for(auto&& f: match)
+                LOG_DEBUG(log_format([&](std::ostream& s)
                 {
-                    auto composite = dynamic_cast<composite_frame*>(f.frame);
-                    if(composite)
+                    s<<"MATCHED: "<<_name;
+                    for(auto&& f: match)
                     {
-                        for (int i = 0; i < composite->get_embedded_frames_count(); i++)
+                        auto composite = dynamic_cast<composite_frame*>(f.frame);
+                        if(composite)
                         {
-                            auto matched = composite->get_frame(i);
-                            s << matched->get_stream()->get_stream_type()<<" "<<f->get_frame_number()<<" "<<std::fixed << matched->get_frame_timestamp()<<" ";
+                            for (int i = 0; i < composite->get_embedded_frames_count(); i++)
+                            {
+                                auto matched = composite->get_frame(i);
+                                s << matched->get_stream()->get_stream_type()<<" "<<f->get_frame_number()<<" "<<std::fixed << matched->get_frame_timestamp()<<" ";
+                            }
+                        }
+                        else {
+                             s<<f->get_stream()->get_stream_type()<<" "<<f->get_frame_number()<<" "<<std::fixed <<(double)f->get_frame_timestamp()<<" ";
                         }
-                    }
-                    else {
-                         s<<f->get_stream()->get_stream_type()<<" "<<f->get_frame_number()<<" "<<std::fixed <<(double)f->get_frame_timestamp()<<" ";
-                    }
 
 
-                }
-                s<<"\n";
-                LOG_DEBUG(s.str());
+                    }
+                    s<<"\n";
+                }));
                 frame_holder composite = env.source->allocate_composite_frame(std::move(match));
                 if (composite.frame)
                 {
-                    s <<"SYNCED "<<_name<<"--> "<< composite->get_stream()->get_stream_type() << " " << composite->get_frame_number() << ", "<<std::fixed<< composite->get_frame_timestamp()<<"\n";
+                    LOG_DEBUG(log_format([&](std::ostream& s)
+                    {
+                        s <<"SYNCED "<<_name<<"--> "<< composite->get_stream()->get_stream_type() << " " << composite->get_frame_number() << ", "<<std::fixed<< composite->get_frame_timestamp()<<"\n";
+                    }));
 
                     auto cb = begin_callback();
+                    TRACE_FRAME_EVENT(TRACE_SYNC_DISPATCH, composite.frame);
                     _callback(std::move(composite), env);
                 }
             }
-        } while (synced_frames.size() > 0);
+        } while (synced);
     }
 
     frame_number_composite_matcher::frame_number_composite_matcher(std::vector<std::shared_ptr<matcher>> matchers)
@@ -364,8 +417,10 @@ namespace librealsense
     {
     }
 
-    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, size_t m)
     {
+        if (_last_arrived.size() <= m)
+            _last_arrived.resize(m + 1);
         _last_arrived[m] =f->get_frame_number();
     }
 
@@ -379,38 +434,34 @@ namespace librealsense
     }
     void frame_number_composite_matcher::clean_inactive_streams(frame_holder& f)
     {
-        std::vector<stream_id> inactive_matchers;
-        for(auto m: _matchers)
+        for(auto&& m: _stream_matchers)
         {
-            if (_last_arrived[m.second.get()] && (fabs((long long)f->get_frame_number() - (long long)_last_arrived[m.second.get()])) > 5)
+            auto i = m.second;
+            if (i < _last_arrived.size() && _last_arrived[i] && (fabs((long long)f->get_frame_number() - (long long)_last_arrived[i])) > 5)
             {
-                std::stringstream s;
-                s << "clean inactive stream in "<<_name;
-                for (auto stream : m.second->get_streams_types())
+                LOG_DEBUG(log_format([&](std::ostream& s)
                 {
-                    s << stream << " ";
-                }
-                LOG_DEBUG(s.str());
+                    s << "clean inactive stream in "<<_name;
+                    for (auto stream : _matchers[i]->get_streams_types())
+                    {
+                        s << stream << " ";
+                    }
+                }));
 
-                inactive_matchers.push_back(m.first);
-                m.second->set_active(false);
+                _matchers[i]->set_active(false);
+                get_frames_queue(i).clear();
             }
         }
-
-        for(auto id: inactive_matchers)
-        {
-            _frames_queue[_matchers[id].get()].clear();
-        }
     }
 
-    bool frame_number_composite_matcher::skip_missing_stream(std::vector<matcher*> synced, matcher* missing)
+    bool frame_number_composite_matcher::skip_missing_stream(const std::vector<size_t>& synced, size_t missing)
     {
         frame_holder* synced_frame;
 
-         if(!missing->get_active())
+         if(!_matchers[missing]->get_active())
              return true;
 
-        _frames_queue[synced[0]].peek(&synced_frame);
+        _frames_queue[synced[0]]->peek(&synced_frame);
 
         auto next_expected = _next_expected[missing];
 
@@ -421,10 +472,9 @@ namespace librealsense
         return false;
     }
 
-    void frame_number_composite_matcher::update_next_expected(const frame_holder& f)
+    void frame_number_composite_matcher::update_next_expected(const frame_holder& f, size_t m)
     {
-        auto matcher = find_matcher(f);
-        _next_expected[matcher.get()] = f.frame->get_frame_number()+1.;
+        _next_expected[m] = f.frame->get_frame_number()+1.;
     }
 
     std::pair<double, double> extract_timestamps(frame_holder & a, frame_holder & b)
@@ -466,65 +516,60 @@ namespace librealsense
         return ts.first < ts.second;
     }
 
-    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, size_t m)
     {
+        if (_last_arrived.size() <= m)
+            _last_arrived.resize(m + 1);
         _last_arrived[m] = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
     }
 
-    void timestamp_composite_matcher::update_next_expected(const frame_holder & f)
+    void timestamp_composite_matcher::update_next_expected(const frame_holder & f, size_t m)
     {
         auto fps = f.frame->get_stream()->get_framerate();
         auto gap = 1000 / fps;
 
-        auto matcher = find_matcher(f);
-
-        _next_expected[matcher.get()] = f.frame->get_frame_timestamp() + gap;
-        _next_expected_domain[matcher.get()] = f.frame->get_frame_timestamp_domain();
+        _next_expected[m] = f.frame->get_frame_timestamp() + gap;
+        _next_expected_domain[m] = f.frame->get_frame_timestamp_domain();
     }
 
     void timestamp_composite_matcher::clean_inactive_streams(frame_holder& f)
     {
-        std::vector<stream_id> dead_matchers;
         auto now = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
-        for(auto m: _matchers)
+        for(auto&& m: _stream_matchers)
         {
-            if(_last_arrived[m.second.get()] && (now - _last_arrived[m.second.get()]) > 500)
+            auto i = m.second;
+            if(i < _last_arrived.size() && _last_arrived[i] && (now - _last_arrived[i]) > 500)
             {
-                std::stringstream s;
-                s << "clean inactive stream in "<<_name;
-                for (auto stream : m.second->get_streams_types())
+                LOG_DEBUG(log_format([&](std::ostream& s)
                 {
-                    s << stream << " ";
-                }
-                LOG_DEBUG(s.str());
+                    s << "clean inactive stream in "<<_name;
+                    for (auto stream : _matchers[i]->get_streams_types())
+                    {
+                        s << stream << " ";
+                    }
+                }));
 
-                dead_matchers.push_back(m.first);
-                m.second->set_active(false);
+                _matchers[i]->set_active(false);
+                remove_frames_queue(i);
             }
         }
-
-        for(auto id: dead_matchers)
-        {
-            _frames_queue[_matchers[id].get()].clear();
-            _frames_queue.erase(_matchers[id].get());
-        }
     }
 
-    bool timestamp_composite_matcher::skip_missing_stream(std::vector<matcher*> synced, matcher* missing)
+    bool timestamp_composite_matcher::skip_missing_stream(const std::vector<size_t>& synced, size_t missing)
     {
-        if(!missing->get_active())
+        if(!_matchers[missing]->get_active())
             return true;
 
         frame_holder* synced_frame;
 
-        _frames_queue[synced[0]].peek(&synced_frame);
+        _frames_queue[synced[0]]->peek(&synced_frame);
 
         auto next_expected = _next_expected[missing];
 
-        auto it = _next_expected_domain.find(missing);
-        if (it != _next_expected_domain.end())
+        auto domain = _next_expected_domain[missing];
+        if (domain != RS2_TIMESTAMP_DOMAIN_COUNT)
         {
-            if (it->second != (*synced_frame)->get_frame_timestamp_domain())
+            if (domain != (*synced_frame)->get_frame_timestamp_domain())
             {
                 return false;
             }
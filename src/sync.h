@@ -117,36 +117,56 @@ namespace librealsense
 
         virtual bool are_equivalent(frame_holder& a, frame_holder& b) = 0;
         virtual bool is_smaller_than(frame_holder& a, frame_holder& b) = 0;
-        virtual bool skip_missing_stream(std::vector<matcher*> synced, matcher* missing)  = 0;
+        virtual bool skip_missing_stream(const std::vector<size_t>& synced, size_t missing)  = 0;
         virtual void clean_inactive_streams(frame_holder& f) = 0;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) = 0;
+        virtual void update_last_arrived(frame_holder& f, size_t m) = 0;
 
         void dispatch(frame_holder f, syncronization_environment env) override;
         void sync(frame_holder f, syncronization_environment env) override;
-        std::shared_ptr<matcher> find_matcher(const frame_holder& f);
+        size_t find_matcher(const frame_holder& f);
 
     protected:
-        virtual void update_next_expected(const frame_holder& f) = 0;
+        virtual void update_next_expected(const frame_holder& f, size_t m) = 0;
+
+        // Matchers are numbered in the order they are first seen, and their state is kept in arrays at that index
+        size_t add_matcher(std::shared_ptr<matcher> m);
+        size_t get_matcher_index(stream_id stream) const;
+        void set_matcher_index(stream_id stream, size_t index);
+        // Frames of a matcher, which from then on takes part in sync
+        single_consumer_queue<frame_holder>& get_frames_queue(size_t index);
+        // Drops the frames of a matcher, which no longer takes part in sync until its next frame
+        void remove_frames_queue(size_t index);
+
+        static const size_t no_matcher = static_cast<size_t>(-1);
+
+        std::vector<std::shared_ptr<matcher>> _matchers;
+        std::vector<std::pair<stream_id, size_t>> _stream_matchers;
+        std::vector<std::unique_ptr<single_consumer_queue<frame_holder>>> _frames_queue;
+        std::vector<bool> _frames_queued;
+        std::vector<double> _next_expected;
+        std::vector<rs2_timestamp_domain> _next_expected_domain; // RS2_TIMESTAMP_DOMAIN_COUNT until the first frame
 
-        std::map<matcher*, single_consumer_queue<frame_holder>> _frames_queue;
-        std::map<stream_id, std::shared_ptr<matcher>> _matchers;
-        std::map<matcher*, double> _next_expected;
-        std::map<matcher*, rs2_timestamp_domain> _next_expected_domain;
+    private:
+        // Reused by every sync, which runs for every frame
+        std::vector<frame_holder*> _frames_arrived;
+        std::vector<size_t> _frames_arrived_matchers;
+        std::vector<size_t> _synced_frames;
+        std::vector<size_t> _missing_streams;
     };
 
     class frame_number_composite_matcher : public composite_matcher
     {
     public:
         frame_number_composite_matcher(std::vector<std::shared_ptr<matcher>> matchers);
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, size_t m) override;
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
-        bool skip_missing_stream(std::vector<matcher*> synced, matcher* missing) override;
+        bool skip_missing_stream(const std::vector<size_t>& synced, size_t missing) override;
         void clean_inactive_streams(frame_holder& f) override;
-        void update_next_expected(const frame_holder& f) override;
+        void update_next_expected(const frame_holder& f, size_t m) override;
 
     private:
-         std::map<matcher*,unsigned long long> _last_arrived;
+         std::vector<unsigned long long> _last_arrived;
     };
 
     class timestamp_composite_matcher : public composite_matcher
@@ -155,14 +175,14 @@ namespace librealsense
         timestamp_composite_matcher(std::vector<std::shared_ptr<matcher>> matchers);
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, size_t m) override;
         void clean_inactive_streams(frame_holder& f) override;
-        bool skip_missing_stream(std::vector<matcher*> synced, matcher* missing) override;
-        void update_next_expected(const frame_holder & f) override;
+        bool skip_missing_stream(const std::vector<size_t>& synced, size_t missing) override;
+        void update_next_expected(const frame_holder & f, size_t m) override;
 
     private:
         bool are_equivalent(double a, double b, int fps);
-        std::map<matcher*, double> _last_arrived;
+        std::vector<double> _last_arrived;
 
     };
 }
@@ -108,7 +108,7 @@ namespace librealsense
         register_metadata(RS2_FRAME_METADATA_ACTUAL_EXPOSURE, std::make_shared<md_tm2_parser>(RS2_FRAME_METADATA_ACTUAL_EXPOSURE));
         register_metadata(RS2_FRAME_METADATA_TEMPERATURE    , std::make_shared<md_tm2_parser>(RS2_FRAME_METADATA_TEMPERATURE));
         //Replacing md parser for RS2_FRAME_METADATA_TIME_OF_ARRIVAL
-        _metadata_parsers->operator[](RS2_FRAME_METADATA_TIME_OF_ARRIVAL) = std::make_shared<md_tm2_parser>(RS2_FRAME_METADATA_TIME_OF_ARRIVAL);
+        _metadata_parsers->set(RS2_FRAME_METADATA_TIME_OF_ARRIVAL, std::make_shared<md_tm2_parser>(RS2_FRAME_METADATA_TIME_OF_ARRIVAL));
     }
 
     tm2_sensor::~tm2_sensor()
@@ -883,7 +883,12 @@ namespace librealsense
         _dispatcher.invoke([this, c](dispatcher::cancellable_timer ct)
         {
             uint8_t controller_id = 0;
-            auto status = _tm_dev->ControllerConnect(c, controller_id);
+            Status status;
+            {
+                // Connecting waits for the controller to answer
+                blocking_region blocking;
+                status = _tm_dev->ControllerConnect(c, controller_id);
+            }
             if (status != Status::SUCCESS)
             {
                 raise_error_notification(to_string() << "Failed to send connect to controller " << c.macAddress << "(Status: " << get_string(status) << ")");
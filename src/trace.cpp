@@ -0,0 +1,246 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "trace.h"
+#include "types.h"
+#include "core/streaming.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+namespace librealsense
+{
+    std::atomic<bool> trace_recording(false);
+
+    namespace
+    {
+        const uint64_t trace_ring_capacity = 1 << 13; // most recent events kept per thread, power of two
+
+        // A ring slot is a seqlock: its sequence is odd while the owning thread writes it, and 2 * (n + 1) once it holds the
+        // event numbered n. The fields are atomics, so a dump can read a slot that is being overwritten and tell by the sequence
+        struct trace_slot
+        {
+            std::atomic<uint64_t> sequence{ 0 };
+            std::atomic<uint64_t> time_ns{ 0 };
+            std::atomic<uint64_t> frame_number{ 0 };
+            std::atomic<uint32_t> type_and_stream{ 0 }; // type, stream and stream index, a byte each
+        };
+
+        struct trace_ring
+        {
+            explicit trace_ring(int id)
+                : thread_id(id), slots(new trace_slot[trace_ring_capacity]), written(0), retired(false) {}
+
+            const int thread_id;
+            std::unique_ptr<trace_slot[]> slots;
+            std::atomic<uint64_t> written;  // advanced only by the owning thread, once an event is complete
+            std::atomic<bool> retired;      // the owning thread has exited
+        };
+
+        class trace_registry
+        {
+        public:
+            std::shared_ptr<trace_ring> add()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                // The events of exited threads are kept for the next dump, but only for the most recent threads
+                const size_t max_retired = 32;
+                size_t retired = std::count_if(_rings.begin(), _rings.end(),
+                    [](const std::shared_ptr<trace_ring>& r) { return r->retired.load(); });
+                for (auto it = _rings.begin(); retired > max_retired && it != _rings.end();)
+                {
+                    if ((*it)->retired) { it = _rings.erase(it); --retired; }
+                    else ++it;
+                }
+
+                auto ring = std::make_shared<trace_ring>(_next_id++);
+                _rings.push_back(ring);
+                return ring;
+            }
+
+            std::vector<std::shared_ptr<trace_ring>> get_rings()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _rings;
+            }
+
+        private:
+            std::mutex _mutex;
+            std::vector<std::shared_ptr<trace_ring>> _rings;
+            int _next_id = 0;
+        };
+
+        trace_registry& get_registry()
+        {
+            static trace_registry registry;
+            return registry;
+        }
+
+        struct thread_trace
+        {
+            std::shared_ptr<trace_ring> ring;
+            ~thread_trace() { if (ring) ring->retired = true; }
+        };
+
+        trace_ring& get_thread_ring()
+        {
+            static thread_local thread_trace local;
+            if (!local.ring) local.ring = get_registry().add();
+            return *local.ring;
+        }
+
+        const char* get_event_name(trace_event_type type)
+        {
+            switch (type)
+            {
+            case TRACE_BACKEND_DEQUEUE: return "Backend Dequeue";
+            case TRACE_UNPACK_BEGIN:
+            case TRACE_UNPACK_END: return "Unpack";
+            case TRACE_PUBLISH: return "Publish";
+            case TRACE_SYNC_ENQUEUE: return "Sync Enqueue";
+            case TRACE_SYNC_DISPATCH: return "Sync Dispatch";
+            case TRACE_PROCESSING_BEGIN:
+            case TRACE_PROCESSING_END: return "Processing";
+            case TRACE_CALLBACK_BEGIN:
+            case TRACE_CALLBACK_END: return "Callback";
+            default: return "Unknown";
+            }
+        }
+
+        char get_event_phase(trace_event_type type)
+        {
+            switch (type)
+            {
+            case TRACE_UNPACK_BEGIN:
+            case TRACE_PROCESSING_BEGIN:
+            case TRACE_CALLBACK_BEGIN: return 'B';
+            case TRACE_UNPACK_END:
+            case TRACE_PROCESSING_END:
+            case TRACE_CALLBACK_END: return 'E';
+            default: return 'i';
+            }
+        }
+    }
+
+    void enable_trace(bool enable)
+    {
+#ifdef RS2_FRAME_TRACE
+        trace_recording = enable;
+#else
+        if (enable)
+            throw not_implemented_exception("librealsense was built without frame tracing (BUILD_FRAME_TRACE)");
+#endif
+    }
+
+    void record_trace_event(trace_event_type type, rs2_stream stream, int index, unsigned long long frame_number)
+    {
+        auto& ring = get_thread_ring();
+        auto n = ring.written.load(std::memory_order_relaxed);
+        auto time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        auto& slot = ring.slots[n & (trace_ring_capacity - 1)];
+        slot.sequence.store(2 * n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.time_ns.store(time_ns, std::memory_order_relaxed);
+        slot.frame_number.store(frame_number, std::memory_order_relaxed);
+        slot.type_and_stream.store(static_cast<uint32_t>(type) | static_cast<uint8_t>(stream) << 8 | static_cast<uint8_t>(index) << 16, std::memory_order_relaxed);
+        slot.sequence.store(2 * n + 2, std::memory_order_release);
+
+        ring.written.store(n + 1, std::memory_order_release);
+    }
+
+    void record_trace_event(trace_event_type type, const frame_interface* frame)
+    {
+        begin_trace_span(type, frame);
+    }
+
+    trace_span begin_trace_span(trace_event_type type, const frame_interface* frame)
+    {
+        trace_span span;
+        span.recording = true;
+        span.frame_number = frame->get_frame_number();
+        if (auto stream = frame->get_stream())
+        {
+            span.stream = stream->get_stream_type();
+            span.index = stream->get_stream_index();
+        }
+        record_trace_event(type, span.stream, span.index, span.frame_number);
+        return span;
+    }
+
+    void dump_trace(std::ostream& out)
+    {
+        struct thread_events
+        {
+            int thread_id;
+            std::vector<trace_event> events;
+        };
+        std::vector<thread_events> threads;
+        uint64_t origin = std::numeric_limits<uint64_t>::max();
+
+        for (auto&& ring : get_registry().get_rings())
+        {
+            auto end = ring->written.load(std::memory_order_acquire);
+            auto begin = end > trace_ring_capacity ? end - trace_ring_capacity : 0;
+
+            thread_events copy{ ring->thread_id, {} };
+            copy.events.reserve(static_cast<size_t>(end - begin));
+            for (auto i = begin; i < end; ++i)
+            {
+                // The owning thread keeps writing while we copy, a slot it has reused or is rewriting no longer holds event i
+                auto&& slot = ring->slots[i & (trace_ring_capacity - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != 2 * i + 2)
+                    continue;
+
+                trace_event e;
+                e.time_ns = slot.time_ns.load(std::memory_order_relaxed);
+                e.frame_number = slot.frame_number.load(std::memory_order_relaxed);
+                auto type_and_stream = slot.type_and_stream.load(std::memory_order_relaxed);
+                e.type = static_cast<trace_event_type>(type_and_stream & 0xff);
+                e.stream = static_cast<uint8_t>(type_and_stream >> 8);
+                e.stream_index = static_cast<uint8_t>(type_and_stream >> 16);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == 2 * i + 2)
+                    copy.events.push_back(e);
+            }
+
+            if (copy.events.empty()) continue;
+            origin = std::min(origin, copy.events.front().time_ns);
+            threads.push_back(std::move(copy));
+        }
+
+        out << "{\"traceEvents\":[";
+        auto first = true;
+        for (auto&& thread : threads)
+        {
+            out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.thread_id
+                << ",\"args\":{\"name\":\"librealsense thread " << thread.thread_id << "\"}}";
+            first = false;
+
+            for (auto&& e : thread.events)
+            {
+                auto phase = get_event_phase(e.type);
+                out << ",\n{\"name\":\"" << get_event_name(e.type) << "\",\"cat\":\"frame\",\"ph\":\"" << phase << "\""
+                    << ",\"ts\":" << std::fixed << std::setprecision(3) << (e.time_ns - origin) / 1000.
+                    << ",\"pid\":1,\"tid\":" << thread.thread_id;
+                if (phase == 'i') out << ",\"s\":\"t\"";
+                out << ",\"args\":{\"stream\":\"" << get_string(static_cast<rs2_stream>(e.stream)) << "\""
+                    << ",\"index\":" << static_cast<int>(e.stream_index)
+                    << ",\"frame\":" << e.frame_number << "}}";
+            }
+        }
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    void dump_trace(const std::string& filename)
+    {
+        std::ofstream out(filename);
+        if (!out)
+            throw invalid_value_exception(to_string() << "Could not open " << filename << " for writing the frame trace");
+        dump_trace(out);
+    }
+}
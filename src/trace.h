@@ -0,0 +1,77 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../include/librealsense2/h/rs_sensor.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace librealsense
+{
+    class frame_interface;
+
+    // Points along the frame path, from the backend handing over a buffer to the user callback returning
+    enum trace_event_type : uint8_t
+    {
+        TRACE_BACKEND_DEQUEUE,
+        TRACE_UNPACK_BEGIN,
+        TRACE_UNPACK_END,
+        TRACE_PUBLISH,
+        TRACE_SYNC_ENQUEUE,
+        TRACE_SYNC_DISPATCH,
+        TRACE_PROCESSING_BEGIN,
+        TRACE_PROCESSING_END,
+        TRACE_CALLBACK_BEGIN,
+        TRACE_CALLBACK_END,
+        TRACE_EVENT_TYPE_COUNT
+    };
+
+    // Fixed-size record, so that tracing a point costs a clock read and a few relaxed stores into the ring of the calling thread
+    struct trace_event
+    {
+        uint64_t time_ns;           // steady clock
+        uint64_t frame_number;
+        trace_event_type type;
+        uint8_t stream;             // rs2_stream
+        uint8_t stream_index;
+    };
+
+    // Stream and number of a frame traced at the beginning of a span, kept for its end since the frame may be released in between
+    struct trace_span
+    {
+        bool recording = false;
+        rs2_stream stream = RS2_STREAM_ANY;
+        int index = 0;
+        unsigned long long frame_number = 0;
+    };
+
+    extern std::atomic<bool> trace_recording;
+
+    inline bool trace_enabled() { return trace_recording.load(std::memory_order_relaxed); }
+
+    void enable_trace(bool enable);
+    void record_trace_event(trace_event_type type, rs2_stream stream, int index, unsigned long long frame_number);
+    void record_trace_event(trace_event_type type, const frame_interface* frame);
+    trace_span begin_trace_span(trace_event_type type, const frame_interface* frame);
+
+    // Writes the events still held by the rings of all threads as a Chrome trace (chrome://tracing, Perfetto)
+    void dump_trace(std::ostream& out);
+    void dump_trace(const std::string& filename);
+}
+
+#ifdef RS2_FRAME_TRACE
+// The arguments are only evaluated while recording
+#define TRACE_STREAM_EVENT(type, stream, index, frame_number) do { if (librealsense::trace_enabled()) librealsense::record_trace_event(librealsense::type, stream, index, frame_number); } while(false)
+#define TRACE_FRAME_EVENT(type, frame) do { if (librealsense::trace_enabled()) librealsense::record_trace_event(librealsense::type, frame); } while(false)
+#define TRACE_SPAN_BEGIN(span, type, frame) librealsense::trace_span span; if (librealsense::trace_enabled()) span = librealsense::begin_trace_span(librealsense::type, frame)
+#define TRACE_SPAN_END(span, type) do { if (span.recording) librealsense::record_trace_event(librealsense::type, span.stream, span.index, span.frame_number); } while(false)
+#else
+#define TRACE_STREAM_EVENT(type, stream, index, frame_number) do { } while(false)
+#define TRACE_FRAME_EVENT(type, frame) do { } while(false)
+#define TRACE_SPAN_BEGIN(span, type, frame) do { } while(false)
+#define TRACE_SPAN_END(span, type) do { } while(false)
+#endif
@@ -258,6 +258,13 @@ namespace librealsense
                 CASE(FILTER_SMOOTH_DELTA)
                 CASE(STEREO_BASELINE)
                 CASE(HOLES_FILL)
+                CASE(ZERO_COPY)
+                CASE(CAPTURE_BUFFERS)
+                CASE(CAPTURE_MEMORY)
+                CASE(PARALLEL_UNPACK)
+                CASE(UNPACK_QUEUE_SIZE)
+                CASE(UNPACK_QUEUE_POLICY)
+                CASE(MAX_DOWNSCALE)
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
 #undef CASE
@@ -288,6 +295,8 @@ namespace librealsense
                 CASE(MOTION_XYZ32F)
                 CASE(GPIO_RAW)
                 CASE(6DOF)
+                CASE(NV12)
+                CASE(I420)
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
 #undef CASE
@@ -387,6 +396,20 @@ namespace librealsense
 
 #undef CASE
     }
+
+    const char* get_string(rs2_latency_type value)
+    {
+#define CASE(X) STRCASE(LATENCY, X)
+        switch (value)
+        {
+            CASE(SENSOR_TO_ARRIVAL)
+            CASE(ARRIVAL_TO_CALLBACK)
+            CASE(CALLBACK_DURATION)
+        default: assert(!is_valid(value)); return UNKNOWN_VALUE;
+        }
+#undef CASE
+    }
+
     std::string firmware_version::to_string() const
     {
         if (is_any) return "any";
@@ -24,6 +24,10 @@
 #include <condition_variable>
 #include <functional>
 #include <utility>                          // For std::forward
+#include <type_traits>                      // For std::aligned_storage
+#ifdef _MSC_VER
+#include <intrin.h>                         // For _BitScanForward64
+#endif
 #include "backend.h"
 #include "concurrency.h"
 #if BUILD_EASYLOGGINGPP
@@ -94,13 +98,22 @@ namespace librealsense
     void log_to_console(rs2_log_severity min_severity);
     void log_to_file(rs2_log_severity min_severity, const char * file_path);
 
+    // Lowest severity that is written anywhere, RS2_LOG_SEVERITY_NONE while logging is off
+    extern std::atomic<int> minimum_log_severity;
+
+    // The LOG_ macros check this before evaluating their arguments, so messages below the level cost a single load
+    inline bool log_enabled(rs2_log_severity severity)
+    {
+        return severity >= minimum_log_severity.load(std::memory_order_relaxed);
+    }
+
 #if BUILD_EASYLOGGINGPP
 
-#define LOG_DEBUG(...)   do { CLOG(DEBUG   ,"librealsense") << __VA_ARGS__; } while(false)
-#define LOG_INFO(...)    do { CLOG(INFO    ,"librealsense") << __VA_ARGS__; } while(false)
-#define LOG_WARNING(...) do { CLOG(WARNING ,"librealsense") << __VA_ARGS__; } while(false)
-#define LOG_ERROR(...)   do { CLOG(ERROR   ,"librealsense") << __VA_ARGS__; } while(false)
-#define LOG_FATAL(...)   do { CLOG(FATAL   ,"librealsense") << __VA_ARGS__; } while(false)
+#define LOG_DEBUG(...)   do { if (librealsense::log_enabled(RS2_LOG_SEVERITY_DEBUG)) CLOG(DEBUG   ,"librealsense") << __VA_ARGS__; } while(false)
+#define LOG_INFO(...)    do { if (librealsense::log_enabled(RS2_LOG_SEVERITY_INFO))  CLOG(INFO    ,"librealsense") << __VA_ARGS__; } while(false)
+#define LOG_WARNING(...) do { if (librealsense::log_enabled(RS2_LOG_SEVERITY_WARN))  CLOG(WARNING ,"librealsense") << __VA_ARGS__; } while(false)
+#define LOG_ERROR(...)   do { if (librealsense::log_enabled(RS2_LOG_SEVERITY_ERROR)) CLOG(ERROR   ,"librealsense") << __VA_ARGS__; } while(false)
+#define LOG_FATAL(...)   do { if (librealsense::log_enabled(RS2_LOG_SEVERITY_FATAL)) CLOG(FATAL   ,"librealsense") << __VA_ARGS__; } while(false)
 
 #else // BUILD_EASYLOGGINGPP
 
@@ -112,6 +125,28 @@ namespace librealsense
 
 #endif // BUILD_EASYLOGGINGPP
 
+    // Part of a LOG_ message that takes statements to format, such as a loop over frames:
+    //     LOG_DEBUG("MATCHED: " << log_format([&](std::ostream& s) { for (auto&& f : frames) s << f->get_frame_number() << " "; }));
+    // Like the rest of the message, the function only runs when the message is written.
+    // Format flags it sets, such as std::fixed, do not outlive it on the stream of the logger
+    template<class F>
+    struct log_formatter
+    {
+        F format;
+    };
+
+    template<class F>
+    log_formatter<F> log_format(F format) { return{ format }; }
+
+    template<class F>
+    std::ostream& operator<<(std::ostream& out, const log_formatter<F>& f)
+    {
+        auto flags = out.flags();
+        f.format(out);
+        out.flags(flags);
+        return out;
+    }
+
     // Enhancement for debug mode that incurs performance penalty with STL
     // std::clamp to be introduced with c++17
     template< typename T>
@@ -405,6 +440,7 @@ namespace librealsense
     RS2_ENUM_HELPERS(rs2_notification_category, NOTIFICATION_CATEGORY)
     RS2_ENUM_HELPERS(rs2_playback_status, PLAYBACK_STATUS)
     RS2_ENUM_HELPERS(rs2_matchers, MATCHER)
+    RS2_ENUM_HELPERS(rs2_latency_type, LATENCY_TYPE)
     ////////////////////////////////////////////
     // World's tiniest linear algebra library //
     ////////////////////////////////////////////
@@ -496,9 +532,20 @@ namespace librealsense
 
     struct pixel_format_unpacker
     {
-        bool requires_processing;
+        bool requires_processing; // false for pass-through formats, that can be handed out in the backend buffer as-is
         void(*unpack)(byte * const dest[], const byte * source, int count);
         std::vector<std::pair<stream_descriptor, rs2_format>> outputs;
+        int split_pixels; // 0 unless unpacking a run of whole rows depends only on those rows, so a frame can be unpacked in bands, each a multiple of this many pixels
+        void(*unpack_frame)(byte * const dest[], const byte * source, int width, int height); // used instead of unpack by unpackers that need the frame geometry
+        int downscale; // factor unpack_frame shrinks both dimensions of the frame by, 0 for unpackers that keep the native resolution
+
+        int get_downscale() const { return downscale > 1 ? downscale : 1; }
+
+        void unpack_image(byte * const dest[], const byte * source, int width, int height) const
+        {
+            if (unpack_frame) unpack_frame(dest, source, width, height);
+            else unpack(dest, source, width * height);
+        }
 
         bool satisfies(const stream_profile& request) const
         {
@@ -794,6 +841,20 @@ namespace librealsense
         void release() override { delete this; }
     };
 
+    class frame_allocator : public rs2_frame_allocator
+    {
+        rs2_frame_allocate_ptr aptr;
+        rs2_frame_deallocate_ptr dptr;
+        void * user;
+    public:
+        frame_allocator(rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void * user)
+            : aptr(allocate), dptr(deallocate), user(user) {}
+
+        void* allocate(size_t size) override { return aptr(size, user); }
+        void deallocate(void* buffer, size_t size) override { dptr(buffer, size, user); }
+        void release() override { delete this; }
+    };
+
     typedef void(*devices_changed_function_ptr)(rs2_device_list* removed, rs2_device_list* added, void * user);
 
     class devices_changed_callback: public rs2_devices_changed_callback
@@ -818,11 +879,25 @@ namespace librealsense
         void release() override { delete this; }
     };
 
+    class executor_callback : public rs2_executor_callback
+    {
+        rs2_executor_callback_ptr nptr;
+        void * user;
+    public:
+        executor_callback(rs2_executor_callback_ptr on_task, void * user) : nptr(on_task), user(user) {}
+
+        void on_task(rs2_task* task) override { nptr(task, user); }
+        void release() override { delete this; }
+    };
+
+    typedef std::shared_ptr<rs2_executor_callback> executor_callback_ptr;
+
     typedef std::unique_ptr<rs2_log_callback, void(*)(rs2_log_callback*)> log_callback_ptr;
     typedef std::shared_ptr<rs2_frame_callback> frame_callback_ptr;
     typedef std::shared_ptr<rs2_frame_processor_callback> frame_processor_callback_ptr;
     typedef std::shared_ptr<rs2_notifications_callback> notifications_callback_ptr;
     typedef std::shared_ptr<rs2_devices_changed_callback> devices_changed_callback_ptr;
+    typedef std::shared_ptr<rs2_frame_allocator> frame_allocator_ptr;
 
     using internal_callback = std::function<void(rs2_device_list* removed, rs2_device_list* added)>;
     class devices_changed_callback_internal : public rs2_devices_changed_callback
@@ -907,89 +982,143 @@ namespace librealsense
         return (c0 << 24) | (c1 << 16) | (c2 << 8) | c3;
     }
 
-    template<class T, int C>
+    inline int find_first_set_bit(uint64_t word)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(word);
+#endif
+    }
+
+    // Fixed-capacity pool of T objects with lock-free allocation
+    // Free slots are tracked in a bitmap that is claimed and released with atomic operations,
+    // objects are constructed on allocation and destroyed on deallocation
+    // The capacity is chosen at construction time, C only provides the default
+    template<class T, int C = RS2_USER_QUEUE_SIZE>
     class small_heap
     {
-        T buffer[C];
-        bool is_free[C];
+        typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type slot;
+
+        size_t capacity;
+        std::unique_ptr<slot[]> buffer;
+        std::unique_ptr<std::atomic<uint64_t>[]> free_bits; // set bits mark free slots
+        size_t words;
+        std::atomic<int> size;
+        std::atomic<bool> keep_allocating;
+        std::atomic<int> waiters;
         std::mutex mutex;
-        bool keep_allocating = true;
         std::condition_variable cv;
-        int size = 0;
+
+        T* begin() const { return reinterpret_cast<T*>(buffer.get()); }
 
     public:
-        small_heap()
+        explicit small_heap(size_t capacity = C)
+            : capacity(capacity), buffer(new slot[capacity]),
+              free_bits(new std::atomic<uint64_t>[(capacity + 63) / 64]), words((capacity + 63) / 64),
+              size(0), keep_allocating(true), waiters(0)
         {
-            for (auto i = 0; i < C; i++)
+            for (size_t w = 0; w < words; w++)
             {
-                is_free[i] = true;
-                buffer[i] = std::move(T());
+                auto bits_in_word = std::min<size_t>(64, capacity - w * 64);
+                free_bits[w] = (bits_in_word == 64) ? ~0ULL : ((1ULL << bits_in_word) - 1);
             }
         }
 
-        T * allocate()
+        small_heap(const small_heap&) = delete;
+        small_heap& operator=(const small_heap&) = delete;
+
+        ~small_heap()
         {
-            std::unique_lock<std::mutex> lock(mutex);
-            if (!keep_allocating) return nullptr;
+            for (size_t w = 0; w < words; w++)
+            {
+                auto bits_in_word = std::min<size_t>(64, capacity - w * 64);
+                auto all = (bits_in_word == 64) ? ~0ULL : ((1ULL << bits_in_word) - 1);
+                auto used = ~free_bits[w].load() & all;
+                while (used)
+                {
+                    auto bit = find_first_set_bit(used);
+                    used &= used - 1;
+                    begin()[w * 64 + bit].~T();
+                }
+            }
+        }
 
-            for (auto i = 0; i < C; i++)
+        T * allocate()
+        {
+            // Publish the allocation attempt before checking the stop flag,
+            // so that stop_allocation followed by wait_until_empty can never miss it
+            size.fetch_add(1);
+            if (keep_allocating)
             {
-                if (is_free[i])
+                for (size_t w = 0; w < words; w++)
                 {
-                    is_free[i] = false;
-                    size++;
-                    return &buffer[i];
+                    auto bits = free_bits[w].load(std::memory_order_relaxed);
+                    while (bits)
+                    {
+                        auto bit = find_first_set_bit(bits);
+                        if (free_bits[w].compare_exchange_weak(bits, bits & ~(1ULL << bit), std::memory_order_acquire))
+                        {
+                            return new (&buffer[w * 64 + bit]) T();
+                        }
+                    }
                 }
             }
+            release_one();
             return nullptr;
         }
 
         void deallocate(T * item)
         {
-             if (item < buffer || item >= buffer + C)
+            if (!contains(item))
             {
                 throw invalid_value_exception("Trying to return item to a heap that didn't allocate it!");
             }
-            auto i = item - buffer;
-            auto old_value = std::move(buffer[i]);
-            buffer[i] = std::move(T());
-
-            {
-                std::unique_lock<std::mutex> lock(mutex);
-
-                is_free[i] = true;
-                size--;
+            auto i = item - begin();
+            item->~T();
 
-                if (size == 0)
-                {
-                    lock.unlock();
-                    cv.notify_one();
-                }
-            }
+            free_bits[i / 64].fetch_or(1ULL << (i % 64), std::memory_order_release);
+            release_one();
         }
 
         void stop_allocation()
         {
-            std::unique_lock<std::mutex> lock(mutex);
             keep_allocating = false;
         }
 
         void wait_until_empty()
         {
             std::unique_lock<std::mutex> lock(mutex);
+            ++waiters;
 
             const auto ready = [this]()
             {
                 return is_empty();
             };
-            if (!ready() && !cv.wait_for(lock, std::chrono::hours(1000), ready)) // for some reason passing std::chrono::duration::max makes it return instantly
+            auto done = ready() || cv.wait_for(lock, std::chrono::hours(1000), ready); // for some reason passing std::chrono::duration::max makes it return instantly
+            --waiters;
+            if (!done)
             {
                 throw invalid_value_exception("Could not flush one of the user controlled objects!");
             }
         }
 
+        bool contains(const T* item) const { return item >= begin() && item < begin() + capacity; }
         bool is_empty() const { return size == 0; }
         int get_size() const { return size; }
+        size_t get_capacity() const { return capacity; }
+
+    private:
+        void release_one()
+        {
+            if (size.fetch_sub(1) == 1 && waiters)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                cv.notify_all();
+            }
+        }
     };
 
     struct uvc_device_info
@@ -1197,7 +1326,7 @@ namespace librealsense
     public:
         frame_continuation() : continuation([]() {}) {}
 
-        explicit frame_continuation(std::function<void()> continuation, const void* protected_data) : continuation(continuation), protected_data(protected_data) {}
+        explicit frame_continuation(std::function<void()> continuation, const void* protected_data) : continuation(std::move(continuation)), protected_data(protected_data) {}
 
 
         frame_continuation(frame_continuation && other) : continuation(std::move(other.continuation)), protected_data(other.protected_data)
@@ -1278,7 +1407,7 @@ namespace librealsense
             _backend(backend_ref),_active_object([this](dispatcher::cancellable_timer cancellable_timer)
         {
             polling(cancellable_timer);
-        }), _devices_data()
+        }, std::chrono::milliseconds(5000)), _devices_data()
         {
         }
 
@@ -1289,19 +1418,16 @@ namespace librealsense
 
         void polling(dispatcher::cancellable_timer cancellable_timer)
         {
-            if(cancellable_timer.try_sleep(5000))
+            platform::backend_device_group curr(_backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices());
+            if(list_changed(_devices_data.uvc_devices, curr.uvc_devices ) ||
+               list_changed(_devices_data.usb_devices, curr.usb_devices ) ||
+               list_changed(_devices_data.hid_devices, curr.hid_devices ))
             {
-                platform::backend_device_group curr(_backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices());
-                if(list_changed(_devices_data.uvc_devices, curr.uvc_devices ) ||
-                   list_changed(_devices_data.usb_devices, curr.usb_devices ) ||
-                   list_changed(_devices_data.hid_devices, curr.hid_devices ))
+                callback_invocation_holder callback = { _callback_inflight.allocate(), &_callback_inflight };
+                if(callback)
                 {
-                    callback_invocation_holder callback = { _callback_inflight.allocate(), &_callback_inflight };
-                    if(callback)
-                    {
-                        _callback(_devices_data, curr);
-                        _devices_data = curr;
-                    }
+                    _callback(_devices_data, curr);
+                    _devices_data = curr;
                 }
             }
         }
@@ -1342,6 +1468,7 @@ namespace librealsense
         friend HostingClass;
     public:
         signal()
+            : m_subscribers(std::make_shared<subscribers_map>())
         {
         }
 
@@ -1350,7 +1477,7 @@ namespace librealsense
             std::lock_guard<std::mutex> locker(other.m_mutex);
             m_subscribers = std::move(other.m_subscribers);
 
-            other.m_subscribers.clear();
+            other.m_subscribers = std::make_shared<subscribers_map>();
         }
 
         signal& operator=(signal&& other)
@@ -1358,7 +1485,7 @@ namespace librealsense
             std::lock_guard<std::mutex> locker(other.m_mutex);
             m_subscribers = std::move(other.m_subscribers);
 
-            other.m_subscribers.clear();
+            other.m_subscribers = std::make_shared<subscribers_map>();
             return *this;
         }
 
@@ -1369,7 +1496,7 @@ namespace librealsense
             int token = -1;
             for (int i = 0; i < (std::numeric_limits<int>::max)(); i++)
             {
-                if (m_subscribers.find(i) == m_subscribers.end())
+                if (m_subscribers->find(i) == m_subscribers->end())
                 {
                     token = i;
                     break;
@@ -1378,7 +1505,9 @@ namespace librealsense
 
             if (token != -1)
             {
-                m_subscribers.emplace(token, func);
+                auto subscribers = std::make_shared<subscribers_map>(*m_subscribers);
+                subscribers->emplace(token, func);
+                m_subscribers = subscribers;
             }
 
             return token;
@@ -1389,10 +1518,11 @@ namespace librealsense
             std::lock_guard<std::mutex> locker(m_mutex);
 
             bool retVal = false;
-            typename std::map<int, std::function<void(Args...)>>::iterator it = m_subscribers.find(token);
-            if (it != m_subscribers.end())
+            if (m_subscribers->find(token) != m_subscribers->end())
             {
-                m_subscribers.erase(token);
+                auto subscribers = std::make_shared<subscribers_map>(*m_subscribers);
+                subscribers->erase(token);
+                m_subscribers = subscribers;
                 retVal = true;
             }
 
@@ -1410,37 +1540,27 @@ namespace librealsense
         }
 
     private:
+        typedef std::map<int, std::function<void(Args...)>> subscribers_map;
+
         signal(const signal& other);            // non construction-copyable
         signal& operator=(const signal&);       // non copyable
 
         bool raise(Args... args)
         {
-            std::vector<std::function<void(Args...)>> functions;
-            bool retVal = false;
-
-            std::unique_lock<std::mutex> locker(m_mutex);
-            if (m_subscribers.size() > 0)
+            // Subscribing replaces the map rather than changing it, so the subscribers are raised
+            // outside the lock, as they were when raising started, without copying them
+            std::shared_ptr<const subscribers_map> subscribers;
             {
-                typename std::map<int, std::function<void(Args...)>>::iterator it = m_subscribers.begin();
-                while (it != m_subscribers.end())
-                {
-                    functions.emplace_back(it->second);
-                    ++it;
-                }
+                std::lock_guard<std::mutex> locker(m_mutex);
+                subscribers = m_subscribers;
             }
-            locker.unlock();
 
-            if (functions.size() > 0)
+            for (auto&& subscriber : *subscribers)
             {
-                for (auto func : functions)
-                {
-                    func(std::forward<Args>(args)...);
-                }
-
-                retVal = true;
+                subscriber.second(std::forward<Args>(args)...);
             }
 
-            return retVal;
+            return !subscribers->empty();
         }
 
         bool operator()(Args... args)
@@ -1449,7 +1569,7 @@ namespace librealsense
         }
 
         std::mutex m_mutex;
-        std::map<int, std::function<void(Args...)>> m_subscribers;
+        std::shared_ptr<const subscribers_map> m_subscribers;
     };
 
     template <typename T>
@@ -1003,13 +1003,14 @@ namespace librealsense
             }
         }
 
-        void wmf_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int /*buffers*/)
+        int wmf_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers, capture_memory /*memory*/)
         {
             if (_streaming)
                 throw std::runtime_error("Device is already streaming!");
 
             _profiles.push_back(profile);
             _frame_callbacks.push_back(callback);
+            return buffers;
         }
 
         void wmf_uvc_device::play_profile(stream_profile profile, frame_callback callback)
@@ -4,6 +4,7 @@
 #include <librealsense2/rs.hpp>
 #include <iostream>
 #include <iomanip>
+#include <chrono>
 #include <map>
 #include <set>
 #include <cstring>
@@ -156,6 +157,49 @@ string get_str_formats(const set<rs2_format>& formats)
     return ss.str();
 }
 
+void print_latency(context& ctx, device& dev, int seconds)
+{
+    pipeline pipe(ctx);
+    config cfg;
+    cfg.enable_device(dev.get_info(RS2_CAMERA_INFO_SERIAL_NUMBER));
+    auto profile = pipe.start(cfg);
+
+    // Only the steady state is of interest, not the frames that queued up while the streams started
+    auto sensors = profile.get_device().query_sensors();
+    pipe.wait_for_frames();
+    for (auto&& sensor : sensors)
+        sensor.reset_latency_stats();
+
+    auto end = chrono::steady_clock::now() + chrono::seconds(seconds);
+    while (chrono::steady_clock::now() < end)
+        pipe.wait_for_frames();
+
+    cout << "Latency of the default streams over " << seconds << " seconds, in ms:" << endl;
+    cout << "    " << left << setw(16) << "stream" << setw(22) << "latency" << right << setw(8) << "count"
+         << setw(9) << "min" << setw(9) << "mean" << setw(9) << "p50" << setw(9) << "p90"
+         << setw(9) << "p99" << setw(9) << "p99.9" << setw(9) << "max" << endl;
+    for (auto&& stream : profile.get_streams())
+    {
+        for (auto&& sensor : sensors)
+        {
+            for (auto j = 0; j < RS2_LATENCY_TYPE_COUNT; ++j)
+            {
+                auto type = static_cast<rs2_latency_type>(j);
+                auto stats = sensor.get_latency_stats(stream.stream_type(), stream.stream_index(), type);
+                if (!stats.count) continue;
+
+                cout << "    " << left << setw(16) << stream.stream_name() << setw(22) << type << right << setw(8) << stats.count
+                     << fixed << setprecision(2) << setw(9) << stats.min << setw(9) << stats.mean << setw(9) << stats.p50
+                     << setw(9) << stats.p90 << setw(9) << stats.p99 << setw(9) << stats.p999 << setw(9) << stats.max << endl;
+            }
+        }
+    }
+    cout.unsetf(ios::floatfield);
+    cout << endl;
+
+    pipe.stop();
+}
+
 int main(int argc, char** argv) try
 {
     CmdLine cmd("librealsense rs-enumerate-devices example tool", ' ', RS2_API_VERSION_STR);
@@ -164,10 +208,12 @@ int main(int argc, char** argv) try
     SwitchArg show_options("o", "option", "Show all supported options per subdevice");
     SwitchArg show_modes("m", "modes", "Show all supported stream modes per subdevice");
     SwitchArg show_calibration_data("c", "calib_data", "Show extrinsic and intrinsic of all subdevices");
+    ValueArg<int> measure_latency("l", "latency", "Stream the default profiles for the given number of seconds and show the latency distribution of every stream", false, 0, "seconds");
     cmd.add(compact_view_arg);
     cmd.add(show_options);
     cmd.add(show_modes);
     cmd.add(show_calibration_data);
+    cmd.add(measure_latency);
 
     cmd.parse(argc, argv);
 
@@ -423,6 +469,9 @@ int main(int argc, char** argv) try
                 }
             }
         }
+
+        if (measure_latency.getValue() > 0)
+            print_latency(ctx, dev, measure_latency.getValue());
     }
 
     cout << endl;
@@ -0,0 +1,125 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+// Cost of passing frame descriptors around and of a frame archive publish/release round-trip
+// The legacy descriptor keeps the metadata inline, the way frame_additional_data used to
+
+#include "archive.h"
+#include "metadata-parser.h"
+#include "benchmark.h"
+
+#include <array>
+#include <vector>
+
+using namespace librealsense;
+
+struct legacy_frame_additional_data
+{
+    rs2_time_t timestamp = 0;
+    unsigned long long frame_number = 0;
+    rs2_timestamp_domain timestamp_domain = RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK;
+    rs2_time_t      system_time = 0;
+    rs2_time_t      frame_callback_started = 0;
+    uint32_t        metadata_size = 0;
+    bool            fisheye_ae_mode = false;
+    std::array<uint8_t, MAX_META_DATA_SIZE> metadata_blob;
+    rs2_time_t      backend_timestamp = 0;
+
+    legacy_frame_additional_data(double in_timestamp, unsigned long long in_frame_number, double in_system_time, uint8_t md_size, const uint8_t* md_buf, double backend_time)
+        : timestamp(in_timestamp),
+          frame_number(in_frame_number),
+          system_time(in_system_time),
+          metadata_size(md_size),
+          backend_timestamp(backend_time)
+    {
+        if (metadata_size)
+            std::copy(md_buf, md_buf + std::min(md_size, MAX_META_DATA_SIZE), metadata_blob.begin());
+    }
+};
+
+int main()
+{
+    const int rounds = 5;
+    const int iterations = 2000000;
+
+    std::vector<uint8_t> metadata(MAX_META_DATA_SIZE);
+    for (size_t i = 0; i < metadata.size(); i++)
+        metadata[i] = static_cast<uint8_t>(i);
+    auto md_size = static_cast<uint8_t>(metadata.size());
+
+    printf("sizeof(frame_additional_data)        %zu bytes\n", sizeof(frame_additional_data));
+    printf("sizeof(legacy_frame_additional_data) %zu bytes\n", sizeof(legacy_frame_additional_data));
+
+    legacy_frame_additional_data legacy(1, 1, 1, md_size, metadata.data(), 1);
+    benchmarks::report("copy descriptor, inline metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        auto copy = legacy;
+        benchmarks::do_not_optimize(&copy);
+    }));
+
+    frame_additional_data pooled(1, 1, 1, md_size, metadata.data(), 1);
+    benchmarks::report("copy descriptor, pooled metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        auto copy = pooled;
+        benchmarks::do_not_optimize(&copy);
+    }));
+
+    benchmarks::report("move descriptor, inline metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        auto moved = std::move(legacy);
+        benchmarks::do_not_optimize(&moved);
+        legacy = std::move(moved);
+    }));
+
+    benchmarks::report("move descriptor, pooled metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        auto moved = std::move(pooled);
+        benchmarks::do_not_optimize(&moved);
+        pooled = std::move(moved);
+    }));
+
+    benchmarks::report("build descriptor, inline metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        legacy_frame_additional_data fresh(1, 1, 1, md_size, metadata.data(), 1);
+        benchmarks::do_not_optimize(&fresh);
+    }));
+
+    benchmarks::report("build descriptor, pooled metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        frame_additional_data fresh(1, 1, 1, md_size, metadata.data(), 1);
+        benchmarks::do_not_optimize(&fresh);
+    }));
+
+    std::atomic<uint32_t> max_queue_size(16);
+    auto archive = make_archive(RS2_EXTENSION_VIDEO_FRAME, &max_queue_size, nullptr, std::make_shared<metadata_parser_map>());
+
+    frame_additional_data empty;
+    benchmarks::report("alloc_and_track + release, no metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        archive->alloc_and_track(0, empty, false)->release();
+    }));
+
+    benchmarks::report("alloc_and_track + release, 255 bytes metadata", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        archive->alloc_and_track(0, pooled, false)->release();
+    }));
+
+    // Frames are usually released out of a queue, with a few others still held
+    const int in_flight = 8;
+    frame_interface* held[in_flight];
+    benchmarks::report("alloc_and_track + release, 8 frames in flight", benchmarks::best_of(rounds, iterations / in_flight, [&]()
+    {
+        for (auto i = 0; i < in_flight; i++)
+            held[i] = archive->alloc_and_track(0, empty, false);
+        for (auto i = 0; i < in_flight; i++)
+            held[i]->release();
+    }) / in_flight);
+
+    // A 640x480 Z16 buffer, recycled through the archive's buffer pool
+    benchmarks::report("alloc_and_track + release, 600 KB pooled buffer", benchmarks::best_of(rounds, iterations, [&]()
+    {
+        archive->alloc_and_track(640 * 480 * 2, empty, true)->release();
+    }));
+
+    return 0;
+}
@@ -0,0 +1,403 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+// Cost of handing items through single_consumer_queue, next to a lock-free ring queue with the same interface
+// Items are the size of a frame_holder plus a reference count, the way the dispatcher and the syncer queues carry them.
+// The ring was tried as a replacement of the mutex and deque queue and is kept here so the comparison can be rerun:
+// it only pays off when producers and the consumer run on cores of their own, so look at the multi-producer numbers
+// of a machine with at least as many cores as threads in the scenario
+
+#include "concurrency.h"
+#include "benchmark.h"
+
+#include <memory>
+#include <vector>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    inline void cpu_relax()
+    {
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    // Bounded blocking concurrent queue keeping the newest cap items, in a ring of sequenced cells (D. Vyukov's
+    // bounded MPMC queue), so enqueue and dequeue take no lock. A producer finding the ring full drops the oldest
+    // item itself. An empty queue makes the consumer spin for a while, then park on a condition variable that
+    // producers only signal when someone is parked.
+    // The ring holds max_ring_size items at most, the backlog of a larger queue waits in a locked overflow list
+    template<class T>
+    class ring_queue
+    {
+        struct cell
+        {
+            std::atomic<size_t> sequence;
+            typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+
+            T& item() { return *reinterpret_cast<T*>(&storage); }
+        };
+
+        static const int min_spins = 16;
+        static const int max_spins = 1024;
+        static const unsigned int max_ring_size = 1024;
+
+        const size_t cap;
+        const size_t ring_size;          // the sequencing needs two cells at least, a queue of one item checks its size instead
+        std::unique_ptr<cell[]> cells;
+        std::atomic<size_t> enqueue_pos;
+        char enqueue_padding[64];        // keeps producers and consumers off each other's cache line
+        std::atomic<size_t> dequeue_pos;
+        char dequeue_padding[64];
+
+        std::atomic<bool> accepting;
+        std::atomic<int> spin_limit;     // grows while items tend to arrive during the spin, shrinks otherwise
+        // Every producer and a parking consumer update it, so that one of them sees what the other did before
+        std::atomic<int> waiters;
+
+        std::atomic<bool> need_to_flush;
+        std::mutex mutex;
+        std::condition_variable cv;
+
+        // Items that found the ring full while cap was not reached, newer than those in the ring.
+        // Producers keep adding here, rather than to the ring, until the consumer empties it
+        std::deque<T> overflow;
+        std::atomic<size_t> overflowed;
+        std::mutex overflow_mutex;
+
+        size_t ring_count() const
+        {
+            auto head = dequeue_pos.load();
+            auto tail = enqueue_pos.load();
+            return tail > head ? std::min<size_t>(tail - head, ring_size) : 0;
+        }
+
+        bool try_push(T& item)
+        {
+            auto pos = enqueue_pos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto& c = cells[pos % ring_size];
+                auto seq = c.sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+                if (diff == 0)
+                {
+                    if (cap < ring_size && pos - dequeue_pos.load(std::memory_order_acquire) >= cap)
+                        return false;
+                    if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        new (&c.storage) T(std::move(item));
+                        c.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void push(T& item)
+        {
+            if (cap <= ring_size)
+            {
+                while (!try_push(item))
+                {
+                    // Full: drop the oldest item, unless the consumer is just taking it
+                    if (!try_pop(nullptr))
+                        std::this_thread::yield();
+                }
+            }
+            else if (overflowed.load(std::memory_order_acquire) > 0 || !try_push(item))
+            {
+                // The ring holds the oldest items, so they go first once the queue is at cap
+                std::lock_guard<std::mutex> lock(overflow_mutex);
+                if (ring_count() + overflow.size() >= cap && !try_pop(nullptr) && !overflow.empty())
+                    overflow.pop_front();
+                overflow.push_back(std::move(item));
+                overflowed = overflow.size();
+            }
+        }
+
+        bool pop(T* item)
+        {
+            if (try_pop(item))
+                return true;
+            if (overflowed.load(std::memory_order_acquire) == 0)
+                return false;
+
+            std::lock_guard<std::mutex> lock(overflow_mutex);
+            if (overflow.empty())
+                return false;
+            if (item) *item = std::move(overflow.front());
+            overflow.pop_front();
+            overflowed = overflow.size();
+            return true;
+        }
+
+        // Moves the oldest item of the ring into item, or destroys it when item is null
+        bool try_pop(T* item)
+        {
+            auto pos = dequeue_pos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto& c = cells[pos % ring_size];
+                auto seq = c.sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+                if (diff == 0)
+                {
+                    if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        if (item) *item = std::move(c.item());
+                        c.item().~T();
+                        c.sequence.store(pos + ring_size, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+    public:
+        explicit ring_queue(unsigned int cap = QUEUE_MAX_SIZE)
+            : cap(std::max(cap, 1u)), ring_size(std::min(std::max(cap, 2u), max_ring_size)), cells(new cell[ring_size]),
+              enqueue_pos(0), dequeue_pos(0), accepting(true), spin_limit(std::thread::hardware_concurrency() > 1 ? min_spins : 0),
+              waiters(0), need_to_flush(false), overflowed(0)
+        {
+            for (size_t i = 0; i < ring_size; ++i)
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        ~ring_queue()
+        {
+            while (try_pop(nullptr));
+        }
+
+        void enqueue(T&& item)
+        {
+            if (!accepting.load(std::memory_order_relaxed))
+                return;
+
+            push(item);
+
+            // Ordered with the update of clear and of a parking consumer: either they see the new item,
+            // or we see that the queue stopped accepting or that the consumer is about to wait
+            auto parked = waiters.fetch_add(0, std::memory_order_acq_rel);
+            if (!accepting.load(std::memory_order_relaxed))
+            {
+                while (pop(nullptr));
+                return;
+            }
+            if (parked > 0)
+            {
+                { std::lock_guard<std::mutex> lock(mutex); }
+                cv.notify_one();
+            }
+        }
+
+        bool dequeue(T* item, unsigned int timeout_ms = 5000)
+        {
+            if (!accepting.load(std::memory_order_relaxed)) accepting = true;
+            if (pop(item))
+                return true;
+
+            auto spins = spin_limit.load(std::memory_order_relaxed);
+            for (auto i = 0; i < spins && !need_to_flush; ++i)
+            {
+                cpu_relax();
+                if (pop(item))
+                {
+                    spin_limit.store(std::min(spins * 2, max_spins), std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            if (spins) spin_limit.store(std::max(spins / 2, min_spins), std::memory_order_relaxed);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            waiters.fetch_add(1, std::memory_order_acq_rel);
+            auto popped = false;
+            cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&]() { return (popped = pop(item)) || need_to_flush; });
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+            return popped;
+        }
+
+        bool try_dequeue(T* item)
+        {
+            if (!accepting.load(std::memory_order_relaxed)) accepting = true;
+            return pop(item);
+        }
+
+        void clear()
+        {
+            accepting = false;
+            need_to_flush = true;
+
+            waiters.fetch_add(0, std::memory_order_acq_rel);
+            while (pop(nullptr));
+
+            { std::lock_guard<std::mutex> lock(mutex); }
+            cv.notify_all();
+        }
+
+        void start()
+        {
+            need_to_flush = false;
+            accepting = true;
+        }
+
+        size_t size()
+        {
+            return ring_count() + overflowed.load();
+        }
+    };
+
+    struct item
+    {
+        std::shared_ptr<int> owner;
+        unsigned long long number;
+    };
+
+    // Enqueue and dequeue on the one thread, the queue never waits
+    template<class Queue>
+    double handoff_on_one_thread()
+    {
+        Queue q(QUEUE_MAX_SIZE);
+        auto owner = std::make_shared<int>(0);
+        unsigned long long n = 0;
+        return benchmarks::best_of(5, 200000, [&]()
+        {
+            q.enqueue({ owner, n++ });
+            item out;
+            q.try_dequeue(&out);
+            benchmarks::do_not_optimize(&out);
+        });
+    }
+
+    // Enqueue into a full queue, which drops the oldest item every time
+    template<class Queue>
+    double enqueue_into_full_queue()
+    {
+        Queue q(QUEUE_MAX_SIZE);
+        auto owner = std::make_shared<int>(0);
+        unsigned long long n = 0;
+        for (auto i = 0; i < QUEUE_MAX_SIZE; i++)
+            q.enqueue({ owner, n++ });
+        return benchmarks::best_of(5, 200000, [&]() { q.enqueue({ owner, n++ }); });
+    }
+
+    // Producers enqueue as fast as they can into a queue deep enough to take every item, while the consumer blocks
+    // in dequeue. Returns the time per item until the consumer has them all, or per enqueue when per_enqueue is set
+    template<class Queue>
+    double producers_to_blocking_consumer(int producers, bool per_enqueue)
+    {
+        const int items = 50000;
+        auto best = 0.0;
+        for (auto round = 0; round < 3; round++)
+        {
+            Queue q(items * producers);
+            std::atomic<int> dequeued{ 0 };
+            std::thread consumer([&]()
+            {
+                item out;
+                while (dequeued < items * producers)
+                    if (q.dequeue(&out, 10)) ++dequeued;
+            });
+
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<std::thread> threads;
+            for (auto p = 0; p < producers; p++)
+            {
+                threads.emplace_back([&]()
+                {
+                    auto owner = std::make_shared<int>(0);
+                    for (auto i = 0; i < items; i++)
+                        q.enqueue({ owner, static_cast<unsigned long long>(i) });
+                });
+            }
+            for (auto&& t : threads) t.join();
+            auto enqueued = std::chrono::high_resolution_clock::now();
+            consumer.join();
+            auto end = std::chrono::high_resolution_clock::now();
+
+            auto ns = std::chrono::duration<double, std::nano>((per_enqueue ? enqueued : end) - start).count() / (items * producers);
+            best = round ? std::min(best, ns) : ns;
+        }
+        return best;
+    }
+
+    // Time from an enqueue until the parked consumer has the item, one item in flight at a time
+    template<class Queue>
+    double wake_up_parked_consumer()
+    {
+        const int items = 2000;
+        Queue q(QUEUE_MAX_SIZE), done(QUEUE_MAX_SIZE);
+        std::thread consumer([&]()
+        {
+            item out;
+            for (auto i = 0; i < items; i++)
+            {
+                while (!q.dequeue(&out));
+                done.enqueue(std::move(out));
+            }
+        });
+
+        auto owner = std::make_shared<int>(0);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto i = 0; i < items; i++)
+        {
+            q.enqueue({ owner, static_cast<unsigned long long>(i) });
+            item back;
+            while (!done.dequeue(&back));
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        consumer.join();
+        return std::chrono::duration<double, std::nano>(end - start).count() / items / 2;
+    }
+}
+
+int main()
+{
+    using namespace benchmarks;
+
+    printf("%u hardware threads\n", std::thread::hardware_concurrency());
+
+    printf("enqueue + try_dequeue, one thread\n");
+    report("  mutex and deque", handoff_on_one_thread<single_consumer_queue<item>>());
+    report("  ring", handoff_on_one_thread<ring_queue<item>>());
+
+    printf("enqueue into a full queue, dropping the oldest\n");
+    report("  mutex and deque", enqueue_into_full_queue<single_consumer_queue<item>>());
+    report("  ring", enqueue_into_full_queue<ring_queue<item>>());
+
+    for (auto producers : { 1, 2, 4, 8 })
+    {
+        printf("%d producer%s to a consumer blocking in dequeue, per enqueue / per item delivered\n", producers, producers > 1 ? "s" : "");
+        report("  mutex and deque, enqueue", producers_to_blocking_consumer<single_consumer_queue<item>>(producers, true));
+        report("  ring, enqueue", producers_to_blocking_consumer<ring_queue<item>>(producers, true));
+        report("  mutex and deque, delivered", producers_to_blocking_consumer<single_consumer_queue<item>>(producers, false));
+        report("  ring, delivered", producers_to_blocking_consumer<ring_queue<item>>(producers, false));
+    }
+
+    printf("enqueue to a parked consumer until it has the item\n");
+    report("  mutex and deque", wake_up_parked_consumer<single_consumer_queue<item>>());
+    report("  ring", wake_up_parked_consumer<ring_queue<item>>());
+    return 0;
+}
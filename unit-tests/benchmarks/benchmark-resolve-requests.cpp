@@ -0,0 +1,266 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+// Cost of resolving stream requests to native modes and unpackers, on profile sets typical of each camera
+// The legacy resolver rescans every profile, pixel format and unpacker on every call, the way sensor_base::resolve_requests used to
+
+#include "sensor.h"
+#include "stream.h"
+#include "image.h"
+#include "benchmark.h"
+
+#include <map>
+#include <set>
+
+using namespace librealsense;
+
+// A sensor that offers every combination of the given resolutions and frame rates in each of its pixel formats,
+// and exposes the resolve_requests of sensor_base
+class benchmark_sensor : public sensor_base
+{
+public:
+    benchmark_sensor(const std::vector<native_pixel_format>& pixel_formats,
+                     const std::vector<std::pair<uint32_t, uint32_t>>& resolutions,
+                     const std::vector<uint32_t>& frame_rates)
+        : sensor_base("benchmark", nullptr), _resolutions(resolutions), _frame_rates(frame_rates)
+    {
+        for (auto&& pf : pixel_formats)
+            register_pixel_format(pf);
+        _fourccs.reserve(pixel_formats.size());
+        for (auto&& pf : pixel_formats)
+            _fourccs.push_back(pf.fourcc);
+    }
+
+    stream_profiles init_stream_profiles() override
+    {
+        // The same profiles uvc_sensor makes of the modes of a device
+        stream_profiles results;
+        for (auto fourcc : _fourccs)
+        for (auto&& resolution : _resolutions)
+        for (auto fps : _frame_rates)
+        {
+            platform::stream_profile p{ resolution.first, resolution.second, fps, fourcc };
+            native_pixel_format pf{};
+            if (!try_get_pf(p, pf)) continue;
+
+            std::map<std::tuple<rs2_stream, int, rs2_format>, std::shared_ptr<video_stream_profile>> native;
+            for (auto&& unpacker : pf.unpackers)
+            {
+                auto scale = unpacker.get_downscale();
+                if (p.width % scale || p.height % scale) continue;
+
+                for (auto&& output : unpacker.outputs)
+                {
+                    auto key = std::make_tuple(output.first.type, output.first.index, output.second);
+                    std::shared_ptr<video_stream_profile> profile;
+                    if (scale == 1)
+                    {
+                        profile = std::make_shared<video_stream_profile>(p);
+                        profile->set_dims(p.width, p.height);
+                        native[key] = profile;
+                    }
+                    else if (native.count(key))
+                    {
+                        profile = std::make_shared<downscaled_video_stream_profile>(p, native[key], scale);
+                    }
+                    else continue;
+
+                    profile->set_stream_type(output.first.type);
+                    profile->set_stream_index(output.first.index);
+                    profile->set_format(output.second);
+                    profile->set_framerate(fps);
+                    results.push_back(profile);
+                }
+            }
+        }
+        return results;
+    }
+
+    void open(const stream_profiles&) override {}
+    void close() override {}
+    void start(frame_callback_ptr) override {}
+    void stop() override {}
+
+    using sensor_base::resolve_requests;
+
+private:
+    std::vector<uint32_t> _fourccs;
+    std::vector<std::pair<uint32_t, uint32_t>> _resolutions;
+    std::vector<uint32_t> _frame_rates;
+};
+
+// The resolver before the index: the legal fourccs are gathered from all the profiles per call, pooled per stream index,
+// and every unpacker of every pixel format is scored against every pending request
+static std::vector<request_mapping> legacy_resolve_requests(std::vector<native_pixel_format>& pixel_formats,
+                                                            const stream_profiles& profiles, stream_profiles requests)
+{
+    std::map<int, std::set<std::pair<uint32_t, int>>> legal_fourccs;
+    for (auto&& r : requests)
+    {
+        auto sp = to_profile(r.get());
+        for (auto&& mode : profiles)
+        {
+            if (auto backend_profile = dynamic_cast<backend_stream_profile*>(mode.get()))
+            {
+                auto m = to_profile(mode.get());
+                if (m.fps == sp.fps && m.height == sp.height && m.width == sp.width)
+                {
+                    auto downscaled = dynamic_cast<downscaled_video_stream_profile*>(mode.get());
+                    auto scale = downscaled ? downscaled->get_scale() : 1;
+                    legal_fourccs[sp.index].insert({ backend_profile->get_backend_profile().format, scale });
+                }
+            }
+        }
+    }
+
+    std::set<request_mapping> results;
+    while (!requests.empty() && !pixel_formats.empty())
+    {
+        auto max = 0;
+        size_t best_size = 0;
+        auto best_pf = &pixel_formats.front();
+        auto best_unpacker = &pixel_formats.front().unpackers.front();
+        for (auto&& pf : pixel_formats)
+        {
+            for (auto&& unpacker : pf.unpackers)
+            {
+                auto count = static_cast<int>(std::count_if(begin(requests), end(requests),
+                    [&pf, &legal_fourccs, &unpacker](const std::shared_ptr<stream_profile_interface>& r)
+                {
+                    return unpacker.satisfies(to_profile(r.get())) && legal_fourccs[r->get_stream_index()].count({ pf.fourcc, unpacker.get_downscale() });
+                }));
+
+                if (count > max || (count == max && unpacker.outputs.size() < best_size))
+                {
+                    max = count;
+                    best_size = unpacker.outputs.size();
+                    best_pf = &pf;
+                    best_unpacker = &unpacker;
+                }
+            }
+        }
+
+        if (max == 0) break;
+
+        requests.erase(std::remove_if(begin(requests), end(requests),
+            [best_unpacker, best_pf, &results, &legal_fourccs](const std::shared_ptr<stream_profile_interface>& r)
+        {
+            if (!best_unpacker->satisfies(to_profile(r.get())) || !legal_fourccs[r->get_stream_index()].count({ best_pf->fourcc, best_unpacker->get_downscale() }))
+                return false;
+
+            auto request = dynamic_cast<const video_stream_profile*>(r.get());
+            request_mapping mapping;
+            mapping.unpacker = best_unpacker;
+            mapping.pf = best_pf;
+            if (!request)
+            {
+                mapping.profile = { 0, 0, r->get_framerate(), best_pf->fourcc };
+            }
+            else
+            {
+                auto scale = static_cast<uint32_t>(best_unpacker->get_downscale());
+                mapping.profile = { request->get_width() * scale, request->get_height() * scale, request->get_framerate(), best_pf->fourcc };
+            }
+
+            results.insert(mapping);
+            auto it = results.find(mapping);
+            if (it != results.end())
+                it->original_requests.push_back(r);
+            return true;
+        }), end(requests));
+    }
+
+    if (requests.empty()) return{ begin(results), end(results) };
+
+    throw invalid_value_exception("Subdevice unable to satisfy stream requests!");
+}
+
+// The native profiles matching the requests, the way a user picks them from the sensor's list
+static stream_profiles find_requests(const stream_profiles& profiles, const std::vector<stream_profile>& wanted)
+{
+    stream_profiles requests;
+    for (auto&& w : wanted)
+    {
+        for (auto&& p : profiles)
+        {
+            auto sp = to_profile(p.get());
+            if (sp.stream == w.stream && sp.index == w.index && sp.width == w.width && sp.height == w.height &&
+                sp.fps == w.fps && sp.format == w.format && !dynamic_cast<downscaled_video_stream_profile*>(p.get()))
+            {
+                requests.push_back(p);
+                break;
+            }
+        }
+    }
+    return requests;
+}
+
+// Both resolvers chose the same native modes and unpackers, compared by fourcc and unpacker position
+static bool same_mappings(const std::vector<request_mapping>& a, const std::vector<request_mapping>& b)
+{
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (!(a[i].profile == b[i].profile) || a[i].pf->fourcc != b[i].pf->fourcc ||
+            a[i].unpacker - a[i].pf->unpackers.data() != b[i].unpacker - b[i].pf->unpackers.data() ||
+            a[i].original_requests.size() != b[i].original_requests.size())
+            return false;
+    }
+    return true;
+}
+
+struct scenario
+{
+    const char* name;
+    std::vector<native_pixel_format> pixel_formats;
+    std::vector<std::pair<uint32_t, uint32_t>> resolutions;
+    std::vector<uint32_t> frame_rates;
+    std::vector<stream_profile> requests;
+};
+
+int main()
+{
+    using namespace benchmarks;
+
+    const std::vector<std::pair<uint32_t, uint32_t>> color_resolutions = {
+        { 1920, 1080 }, { 1280, 720 }, { 960, 540 }, { 848, 480 }, { 640, 480 }, { 640, 360 }, { 424, 240 }, { 320, 240 }, { 320, 180 } };
+
+    std::vector<scenario> scenarios = {
+        { "DS5 depth, Z16 + 2 x Y8 848x480", { pf_z16, pf_y8, pf_y8i, pf_y12i, pf_uyvyl, pf_rgb888, pf_w10 },
+          { { 1280, 720 }, { 848, 480 }, { 640, 480 }, { 640, 360 }, { 480, 270 }, { 424, 240 } }, { 6, 15, 30, 60, 90 },
+          { { RS2_STREAM_DEPTH, 0, 848, 480, 30, RS2_FORMAT_Z16 }, { RS2_STREAM_INFRARED, 1, 848, 480, 30, RS2_FORMAT_Y8 }, { RS2_STREAM_INFRARED, 2, 848, 480, 30, RS2_FORMAT_Y8 } } },
+        { "DS5 color, RGB8 1280x720", { pf_yuy2, pf_rw16 }, color_resolutions, { 6, 15, 30, 60 },
+          { { RS2_STREAM_COLOR, 0, 1280, 720, 30, RS2_FORMAT_RGB8 } } },
+        { "SR300 depth, Z16 + Y8 640x480", { pf_invz, pf_sr300_invi, pf_sr300_inzi },
+          { { 640, 480 }, { 640, 240 }, { 320, 240 } }, { 10, 30, 60 },
+          { { RS2_STREAM_DEPTH, 0, 640, 480, 30, RS2_FORMAT_Z16 }, { RS2_STREAM_INFRARED, 1, 640, 480, 30, RS2_FORMAT_Y8 } } },
+        { "SR300 color, BGR8 1920x1080", { pf_yuy2 }, color_resolutions, { 30, 60 },
+          { { RS2_STREAM_COLOR, 0, 1920, 1080, 30, RS2_FORMAT_BGR8 } } },
+    };
+
+    for (auto&& s : scenarios)
+    {
+        auto sensor = std::make_shared<benchmark_sensor>(s.pixel_formats, s.resolutions, s.frame_rates);
+        auto profiles = sensor->get_stream_profiles();
+        auto requests = find_requests(profiles, s.requests);
+        if (requests.size() != s.requests.size())
+        {
+            printf("%s: the sensor does not offer the requested profiles\n", s.name);
+            return 1;
+        }
+
+        auto pixel_formats = s.pixel_formats;
+        if (!same_mappings(sensor->resolve_requests(requests), legacy_resolve_requests(pixel_formats, profiles, requests)))
+        {
+            printf("%s: the resolvers chose different modes\n", s.name);
+            return 1;
+        }
+
+        printf("%s, %zu profiles\n", s.name, profiles.size());
+        report("  legacy resolver",
+            best_of(5, 200, [&]() { auto m = legacy_resolve_requests(pixel_formats, profiles, requests); do_not_optimize(&m); }));
+        report("  sensor_base::resolve_requests",
+            best_of(5, 200, [&]() { auto m = sensor->resolve_requests(requests); do_not_optimize(&m); }));
+    }
+    return 0;
+}
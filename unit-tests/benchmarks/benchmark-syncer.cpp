@@ -0,0 +1,69 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+// Cost of matching frames into framesets by timestamp, for a software device streaming 2, 4 and 8 streams into a syncer
+// Frames are tiny and wrap the caller's pixels, so what is measured is the path from on_video_frame to the syncer's queue
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+#include "benchmark.h"
+
+#include <vector>
+
+int main()
+{
+    using namespace benchmarks;
+
+    // The syncer logs every frameset it matches at debug level
+    rs2::log_to_console(RS2_LOG_SEVERITY_NONE);
+
+    const int W = 64;
+    const int H = 48;
+    const int ticks = 2000;
+    std::vector<uint8_t> pixels(W * H, 0);
+
+    for (auto streams : { 2, 4, 8 })
+    {
+        rs2::software_device dev;
+        auto s = dev.add_sensor("software_sensor");
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        std::vector<rs2::stream_profile> profiles;
+        for (auto i = 0; i < streams; i++)
+            profiles.push_back(s.add_video_stream({ RS2_STREAM_INFRARED, i + 1, i, W, H, 30, 1, RS2_FORMAT_Y8, intrinsics }));
+        dev.create_matcher(RS2_MATCHER_DEFAULT);
+
+        rs2::syncer sync(10);
+        s.open(profiles);
+        s.start(sync);
+
+        // Every round streams the next ticks, so that timestamps keep going up across rounds
+        int tick = 0;
+        size_t framesets = 0, incomplete = 0;
+        auto per_frameset = best_of(5, 1, [&]()
+        {
+            for (auto t = 0; t < ticks; t++, tick++)
+            {
+                for (auto&& p : profiles)
+                    s.on_video_frame({ pixels.data(), [](void*) {}, W, 1, tick * 1000. / 30, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, tick, p });
+
+                rs2::frameset fs;
+                while (sync.poll_for_frames(&fs))
+                {
+                    ++framesets;
+                    if (fs.size() != profiles.size()) ++incomplete;
+                }
+            }
+        }) / ticks;
+
+        s.stop();
+        s.close();
+
+        char name[64];
+        snprintf(name, sizeof(name), "  %d streams, per frameset", streams);
+        report(name, per_frameset);
+        snprintf(name, sizeof(name), "  %d streams, per frame", streams);
+        report(name, per_frameset / streams);
+        printf("  %zu framesets, %zu of them incomplete\n", framesets, incomplete);
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace benchmarks
+{
+    // Runs body() iterations times, repeated rounds times, and returns the best
+    // round in nanoseconds per iteration
+    template<class T>
+    double best_of(int rounds, int iterations, T body)
+    {
+        auto best = 0.0;
+        for (auto r = 0; r < rounds; r++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (auto i = 0; i < iterations; i++)
+                body();
+            auto end = std::chrono::high_resolution_clock::now();
+            auto ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+            best = r ? std::min(best, ns) : ns;
+        }
+        return best;
+    }
+
+    // Makes the compiler assume the object behind p is read and written, so the work that produced it is not optimized away
+    inline void do_not_optimize(const void* p)
+    {
+#ifdef _MSC_VER
+        static const void* volatile escaped;
+        escaped = p;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "g"(p) : "memory");
+#endif
+    }
+
+    inline void report(const char* name, double ns)
+    {
+        printf("%-56s %10.1f ns\n", name, ns);
+    }
+}
@@ -0,0 +1,74 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "../catch/catch.hpp"
+
+#include "archive.h"
+#include "metadata-parser.h"
+
+using namespace librealsense;
+
+namespace
+{
+    // Reports the metadata byte at a fixed offset, scaled, and is supported only where that byte is set
+    class byte_parser : public md_attribute_parser_base
+    {
+    public:
+        explicit byte_parser(int offset) : _offset(offset) {}
+
+        rs2_metadata_type get(const frame& frm) const override
+        {
+            if (!supports(frm))
+                throw invalid_value_exception("metadata byte is not set");
+            return 10 * frm.additional_data.metadata_blob.data()[_offset];
+        }
+
+        bool supports(const frame& frm) const override
+        {
+            return frm.additional_data.metadata_blob.data()[_offset] != 0;
+        }
+
+    private:
+        int _offset;
+    };
+}
+
+TEST_CASE("Bulk metadata query agrees with the per-attribute one", "[archive]")
+{
+    auto parsers = std::make_shared<metadata_parser_map>();
+    parsers->set(RS2_FRAME_METADATA_FRAME_COUNTER, std::make_shared<byte_parser>(0));
+    parsers->set(RS2_FRAME_METADATA_ACTUAL_EXPOSURE, std::make_shared<byte_parser>(1));
+    parsers->set(RS2_FRAME_METADATA_GAIN_LEVEL, std::make_shared<byte_parser>(2));
+    parsers->set(static_cast<rs2_frame_metadata_value>(::RS2_FRAME_METADATA_COUNT - 1), std::make_shared<byte_parser>(3));
+
+    std::atomic<uint32_t> max_queue_size(16);
+    auto archive = make_archive(RS2_EXTENSION_VIDEO_FRAME, &max_queue_size, nullptr, parsers);
+
+    // The gain byte is left at zero, so that parser is registered but does not support this frame
+    uint8_t md[] = { 1, 2, 0, 4 };
+    frame_additional_data data(0, 1, 0, sizeof(md), md, 0);
+    auto f = archive->alloc_and_track(0, data, false);
+    REQUIRE(f);
+
+    rs2_metadata_type values[::RS2_FRAME_METADATA_COUNT];
+    int supported[::RS2_FRAME_METADATA_COUNT];
+    REQUIRE(f->get_frame_metadata_all(values, supported, ::RS2_FRAME_METADATA_COUNT) == 3);
+    for (auto i = 0; i < ::RS2_FRAME_METADATA_COUNT; i++)
+    {
+        CAPTURE(i);
+        auto id = static_cast<rs2_frame_metadata_value>(i);
+        REQUIRE((supported[i] != 0) == f->supports_frame_metadata(id));
+        if (supported[i])
+            REQUIRE(values[i] == f->get_frame_metadata(id));
+        else
+            REQUIRE(values[i] == 0);
+    }
+    REQUIRE(values[RS2_FRAME_METADATA_FRAME_COUNTER] == 10);
+    REQUIRE(values[RS2_FRAME_METADATA_ACTUAL_EXPOSURE] == 20);
+    REQUIRE(values[::RS2_FRAME_METADATA_COUNT - 1] == 40);
+
+    // A shorter table only gets the attributes that fit in it
+    REQUIRE(f->get_frame_metadata_all(values, supported, RS2_FRAME_METADATA_ACTUAL_EXPOSURE) == 1);
+
+    f->release();
+}
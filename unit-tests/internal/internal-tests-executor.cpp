@@ -0,0 +1,188 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "../catch/catch.hpp"
+
+#include "concurrency.h"
+#include <librealsense2/rs.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    // Runs the test on a pool of the given number of threads, then goes back to the default pool
+    class executor_scope
+    {
+    public:
+        explicit executor_scope(unsigned int threads) { configure_executor(threads, 0); }
+        ~executor_scope() { configure_executor(0, 0); }
+    };
+
+    double milliseconds_since(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+TEST_CASE("Dispatchers sharing one worker run their tasks in order", "[executor]")
+{
+    executor_scope one_worker(1);
+
+    const int dispatchers = 20, producers = 4, tasks = 2000;
+    std::vector<std::unique_ptr<dispatcher>> strands;
+    for (auto i = 0; i < dispatchers; i++)
+    {
+        strands.emplace_back(new dispatcher(100000));
+        strands.back()->start();
+    }
+
+    // The first producer numbers its tasks, the others only add to the interleaving
+    std::vector<int> last(dispatchers, -1);
+    std::atomic<int> out_of_order{ 0 }, runs{ 0 };
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&, p]()
+        {
+            for (auto i = 0; i < tasks; i++)
+            {
+                auto d = (i + p) % dispatchers;
+                if (p == 0)
+                    strands[d]->invoke([&, d, i](dispatcher::cancellable_timer) { if (i <= last[d]) ++out_of_order; last[d] = i; ++runs; });
+                else
+                    strands[d]->invoke([&](dispatcher::cancellable_timer) { ++runs; });
+            }
+        });
+    }
+    for (auto&& t : threads) t.join();
+    for (auto&& d : strands) REQUIRE(d->flush());
+
+    REQUIRE(runs == producers * tasks);
+    REQUIRE(out_of_order == 0);
+}
+
+TEST_CASE("Dispatchers flush and stop from their own worker", "[executor]")
+{
+    executor_scope one_worker(1);
+
+    // Flushing waits for a task of another dispatcher, which needs a thread lent by the pool
+    dispatcher a(10), b(10);
+    a.start();
+    b.start();
+    std::atomic<bool> flushed{ false };
+    a.invoke([&](dispatcher::cancellable_timer) { b.invoke([](dispatcher::cancellable_timer) {}); flushed = b.flush(); });
+    REQUIRE(a.flush());
+    REQUIRE(flushed);
+
+    // Stopping wakes a task sleeping on the dispatcher's timer
+    a.invoke([&](dispatcher::cancellable_timer t) { t.try_sleep(2000); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto start = std::chrono::steady_clock::now();
+    a.stop();
+    REQUIRE(milliseconds_since(start) < 1000);
+
+    // A task can stop its own dispatcher
+    a.start();
+    std::atomic<bool> stopped{ false };
+    a.invoke([&](dispatcher::cancellable_timer) { a.stop(); stopped = true; });
+    for (auto i = 0; i < 100 && !stopped; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    REQUIRE(stopped);
+}
+
+TEST_CASE("Periodic active objects stop running once stopped", "[executor]")
+{
+    std::atomic<int> runs{ 0 };
+    active_object<> periodic([&](dispatcher::cancellable_timer) { ++runs; }, std::chrono::milliseconds(20));
+    periodic.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(210));
+    periodic.stop();
+
+    auto at_stop = runs.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    REQUIRE(at_stop >= 3);
+    REQUIRE(runs == at_stop);
+}
+
+TEST_CASE("A dispatcher outlives the replacement of its pool", "[executor]")
+{
+    executor_scope one_worker(1);
+
+    // The dispatcher keeps the old pool, which is destroyed with it once the pool is replaced
+    auto old = std::make_shared<dispatcher>(10);
+    old->start();
+    configure_executor(3, 0);
+
+    std::atomic<bool> done{ false };
+    old->invoke([&](dispatcher::cancellable_timer) { done = true; });
+    for (auto i = 0; i < 100 && !done; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    REQUIRE(done);
+    old.reset();
+}
+
+TEST_CASE("A strand blocked in a callback does not hold up the other strands", "[executor]")
+{
+    executor_scope one_worker(1);
+
+    // The way playback delivery and notifications run the application's callbacks
+    dispatcher callbacks(10), other(10);
+    callbacks.start();
+    other.start();
+
+    std::atomic<bool> in_callback{ false };
+    callbacks.invoke([&](dispatcher::cancellable_timer)
+    {
+        blocking_region blocking;
+        in_callback = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    });
+    while (!in_callback)
+        std::this_thread::yield();
+
+    // The only worker is in the callback, a thread lent by the pool runs the other strand meanwhile
+    std::atomic<bool> ran{ false };
+    auto start = std::chrono::steady_clock::now();
+    other.invoke([&](dispatcher::cancellable_timer) { ran = true; });
+    while (!ran && milliseconds_since(start) < 1000)
+        std::this_thread::yield();
+    auto latency = milliseconds_since(start);
+
+    CAPTURE(latency);
+    REQUIRE(ran);
+    REQUIRE(latency < 250);
+    REQUIRE(callbacks.flush());
+}
+
+TEST_CASE("A dispatcher whose job the application deleted can run and stop", "[executor]")
+{
+    // The application's executor keeps the tasks, to run or delete them later
+    std::vector<rs2_task*> posted;
+    rs2_set_executor([](rs2_task* t, void* user) { static_cast<std::vector<rs2_task*>*>(user)->push_back(t); }, &posted, nullptr);
+
+    std::unique_ptr<dispatcher> d(new dispatcher(10));
+    d->start();
+    std::atomic<int> runs{ 0 };
+    d->invoke([&](dispatcher::cancellable_timer) { ++runs; });
+    REQUIRE(posted.size() == 1);
+    rs2_delete_task(posted.back());
+    posted.clear();
+
+    // The next invoke posts another job, which runs both tasks
+    d->invoke([&](dispatcher::cancellable_timer) { ++runs; });
+    REQUIRE(posted.size() == 1);
+    rs2_run_task(posted.back(), nullptr);
+    posted.clear();
+    REQUIRE(runs == 2);
+
+    // Destroying the dispatcher does not wait for a job that was deleted
+    d->invoke([&](dispatcher::cancellable_timer) { ++runs; });
+    REQUIRE(posted.size() == 1);
+    rs2_delete_task(posted.back());
+    posted.clear();
+    d.reset();
+    REQUIRE(runs == 2);
+
+    rs2_set_executor(nullptr, nullptr, nullptr);
+}
@@ -0,0 +1,46 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "../catch/catch.hpp"
+
+#include "image.h"
+
+#include <random>
+
+using namespace librealsense;
+
+TEST_CASE("RW10 to Y8 unpackers match the scalar reference and stay within the output", "[image]")
+{
+    const size_t guard = 64;
+    const uint8_t guard_value = 0xa5;
+    std::mt19937 rng(10);
+    std::uniform_int_distribution<int> byte_value(0, 255);
+
+    auto variants = get_y8_from_rw10_unpackers();
+    REQUIRE(variants.size() > 0);
+
+    // Every remainder of n modulo the 48 pixels the SIMD variants handle at once, over a few blocks
+    for (auto n = 1; n <= 6 * 48; n++)
+    {
+        CAPTURE(n);
+        std::vector<uint8_t> src((n + 3) / 4 * 5);
+        for (auto&& b : src) b = static_cast<uint8_t>(byte_value(rng));
+
+        std::vector<uint8_t> expected(n);
+        for (auto i = 0; i < n; i++)
+            expected[i] = src[i / 4 * 5 + i % 4];
+
+        for (auto&& v : variants)
+        {
+            if (!v.supported) continue;
+            CAPTURE(v.name);
+
+            std::vector<uint8_t> dst(n + guard, guard_value);
+            byte * const dest[] = { dst.data() };
+            v.unpack(dest, src.data(), n);
+
+            REQUIRE(std::equal(expected.begin(), expected.end(), dst.begin()));
+            REQUIRE(std::count(dst.begin() + n, dst.end(), guard_value) == guard);
+        }
+    }
+}
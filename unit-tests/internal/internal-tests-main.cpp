@@ -0,0 +1,5 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#define CATCH_CONFIG_MAIN
+#include "../catch/catch.hpp"
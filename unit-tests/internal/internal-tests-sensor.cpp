@@ -0,0 +1,264 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "../catch/catch.hpp"
+
+#include "sensor.h"
+#include "image.h"
+#include "environment.h"
+
+#include <random>
+#include <thread>
+
+using namespace librealsense;
+
+namespace
+{
+    // A camera that captures a frame every couple of milliseconds into a fixed set of buffers,
+    // and counts the frames it misses because every buffer is still out
+    class fake_uvc_device : public platform::uvc_device
+    {
+    public:
+        explicit fake_uvc_device(std::vector<platform::stream_profile> profiles) : _profiles(profiles) {}
+
+        ~fake_uvc_device() { stop_capture(); }
+
+        int probe_and_commit(platform::stream_profile profile, platform::frame_callback callback, int buffers, platform::capture_memory) override
+        {
+            _profile = profile;
+            _callback = callback;
+            _frame_size = profile.width * profile.height * 2;
+            _pixels.assign(buffers, std::vector<byte>(_frame_size));
+            _free.assign(buffers, true);
+            return buffers;
+        }
+
+        void stream_on(std::function<void(const notification& n)>) override
+        {
+            _stopping = false;
+            _thread = std::thread([this]() { capture(); });
+        }
+
+        void start_callbacks() override { _streaming = true; }
+        void stop_callbacks() override { _streaming = false; }
+        void close(platform::stream_profile) override { stop_capture(); }
+
+        void set_power_state(platform::power_state state) override { _power = state; }
+        platform::power_state get_power_state() const override { return _power; }
+
+        void init_xu(const platform::extension_unit&) override {}
+        bool set_xu(const platform::extension_unit&, uint8_t, const uint8_t*, int) override { return false; }
+        bool get_xu(const platform::extension_unit&, uint8_t, uint8_t*, int) const override { return false; }
+        platform::control_range get_xu_range(const platform::extension_unit&, uint8_t, int) const override { return {}; }
+
+        bool get_pu(rs2_option, int32_t&) const override { return false; }
+        bool set_pu(rs2_option, int32_t) override { return false; }
+        platform::control_range get_pu_range(rs2_option) const override { return {}; }
+
+        std::vector<platform::stream_profile> get_profiles() const override { return _profiles; }
+
+        void lock() const override {}
+        void unlock() const override {}
+
+        std::string get_device_location() const override { return ""; }
+
+        platform::stream_profile committed() const { return _profile; }
+        int captured() const { return _captured; }
+        int missed() const { return _missed; }
+
+    private:
+        void capture()
+        {
+            while (!_stopping)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                if (!_streaming) continue;
+
+                int buffer = -1;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    for (size_t i = 0; i < _free.size() && buffer < 0; i++)
+                        if (_free[i]) buffer = static_cast<int>(i);
+                    if (buffer < 0) { ++_missed; continue; }
+                    _free[buffer] = false;
+                }
+
+                platform::frame_object f{ _frame_size, 0, _pixels[buffer].data(), nullptr, 0 };
+                _callback(_profile, f, [this, buffer]()
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _free[buffer] = true;
+                });
+                ++_captured;
+            }
+        }
+
+        void stop_capture()
+        {
+            _stopping = true;
+            if (_thread.joinable()) _thread.join();
+        }
+
+        std::vector<platform::stream_profile> _profiles;
+        platform::stream_profile _profile{};
+        platform::frame_callback _callback;
+        size_t _frame_size = 0;
+        std::vector<std::vector<byte>> _pixels;
+        std::vector<bool> _free;
+        std::mutex _mutex;
+        std::thread _thread;
+        std::atomic<bool> _stopping{ true };
+        std::atomic<bool> _streaming{ false };
+        std::atomic<int> _captured{ 0 };
+        std::atomic<int> _missed{ 0 };
+        platform::power_state _power = platform::D3;
+    };
+
+    class counting_timestamp_reader : public frame_timestamp_reader
+    {
+    public:
+        double get_frame_timestamp(const request_mapping&, const platform::frame_object&) override { return ++_counter; }
+        unsigned long long get_frame_counter(const request_mapping&, const platform::frame_object&) const override { return _counter; }
+        rs2_timestamp_domain get_frame_timestamp_domain(const request_mapping&, const platform::frame_object&) const override { return RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME; }
+        void reset() override { _counter = 0; }
+
+    private:
+        unsigned long long _counter = 0;
+    };
+}
+
+TEST_CASE("Banded unpack splits frames on whole unpacker blocks", "[sensor]")
+{
+    auto pf = pf_yuy2;
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<int> byte_value(0, 255);
+
+    for (auto&& unpacker : pf.unpackers)
+    {
+        if (!unpacker.split_pixels) continue;
+        REQUIRE(unpacker.split_pixels == 16);
+
+        // 424 is a multiple of 8 pixels but not of 16, so a band of an odd number of rows splits a YUY2 block
+        const int width = 424, height = 240;
+        request_mapping mode{ { width, height, 30, pf.fourcc }, &pf, &unpacker };
+        auto band_rows = get_unpack_band_rows(mode);
+        REQUIRE(band_rows > 0);
+        REQUIRE(band_rows < height);
+        REQUIRE((band_rows * width) % unpacker.split_pixels == 0);
+        REQUIRE(((height % band_rows) * width) % unpacker.split_pixels == 0);
+
+        std::vector<byte> source(width * height * pf.bytes_per_pixel);
+        for (auto&& b : source) b = static_cast<byte>(byte_value(rng));
+
+        auto bpp = get_image_bpp(unpacker.outputs.front().second) / 8;
+        std::vector<byte> whole(width * height * bpp), banded(whole.size());
+        byte * const whole_dest[] = { whole.data() };
+        unpacker.unpack(whole_dest, source.data(), width * height);
+
+        // Mirrors the bands uvc_sensor hands to its pool, the last one taking the remaining rows
+        for (auto first_row = 0; first_row < height; first_row += band_rows)
+        {
+            auto rows = std::min(band_rows, height - first_row);
+            byte * const band_dest[] = { banded.data() + first_row * width * bpp };
+            unpacker.unpack(band_dest, source.data() + first_row * width * pf.bytes_per_pixel, rows * width);
+        }
+        REQUIRE(banded == whole);
+
+        // Without a whole number of blocks in the frame no band height works, and the frame is unpacked in one go
+        request_mapping odd{ { width + 1, height + 1, 30, pf.fourcc }, &pf, &unpacker };
+        REQUIRE(get_unpack_band_rows(odd) == 0);
+    }
+}
+
+TEST_CASE("Zero-copy frames leave the unpack queue and the backend their buffers", "[sensor]")
+{
+    // Frames are stamped with the time of arrival, the time service is otherwise set up by the context
+    environment::get_instance().set_time_service(std::make_shared<platform::os_time_service>());
+
+    platform::stream_profile native{ 64, 48, 30, pf_yuy2.fourcc };
+    auto camera = std::make_shared<fake_uvc_device>(std::vector<platform::stream_profile>{ native });
+    auto sensor = std::make_shared<uvc_sensor>("fake", camera, std::unique_ptr<frame_timestamp_reader>(new counting_timestamp_reader()), nullptr);
+    sensor->register_pixel_format(pf_yuy2);
+
+    sensor->get_option(RS2_OPTION_ZERO_COPY).set(1);
+    sensor->get_option(RS2_OPTION_CAPTURE_BUFFERS).set(4);
+    sensor->get_option(RS2_OPTION_UNPACK_QUEUE_SIZE).set(2);
+
+    stream_profiles request;
+    for (auto&& p : sensor->get_stream_profiles())
+        if (p->get_format() == RS2_FORMAT_YUYV)
+            request.push_back(p);
+    REQUIRE(request.size() == 1);
+
+    // A slow consumer that keeps the latest frame, the previous one is released as the next arrives
+    frame_holder latest;
+    std::atomic<int> delivered{ 0 };
+    auto on_frame = [&](frame_interface* f)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        latest = frame_holder(f);
+        ++delivered;
+    };
+
+    sensor->open(request);
+    sensor->start(frame_callback_ptr(new internal_frame_callback<decltype(on_frame)>(on_frame),
+        [](rs2_frame_callback* p) { p->release(); }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    sensor->stop();
+    latest = {};
+    sensor->close();
+
+    CAPTURE(camera->captured());
+    REQUIRE(delivered > 10);
+    REQUIRE(camera->missed() == 0);
+}
+
+TEST_CASE("Max downscale picks a larger capture for a resolution the sensor also streams natively", "[sensor]")
+{
+    environment::get_instance().set_time_service(std::make_shared<platform::os_time_service>());
+
+    auto camera = std::make_shared<fake_uvc_device>(std::vector<platform::stream_profile>{
+        { 1920, 1080, 30, pf_yuy2.fourcc }, { 1280, 720, 30, pf_yuy2.fourcc }, { 640, 360, 30, pf_yuy2.fourcc } });
+    auto sensor = std::make_shared<uvc_sensor>("fake", camera, std::unique_ptr<frame_timestamp_reader>(new counting_timestamp_reader()), nullptr);
+    sensor->register_pixel_format(pf_yuy2);
+
+    // 640x360 is listed once, as the native mode
+    stream_profiles request;
+    for (auto&& p : sensor->get_stream_profiles())
+    {
+        auto vp = dynamic_cast<video_stream_profile_interface*>(p.get());
+        if (p->get_format() == RS2_FORMAT_RGB8 && vp->get_width() == 640 && vp->get_height() == 360)
+            request.push_back(p);
+    }
+    REQUIRE(request.size() == 1);
+
+    std::vector<std::pair<int, uint32_t>> expected_captures = { { 1, 640 }, { 2, 1280 }, { 3, 1920 } };
+    for (auto&& e : expected_captures)
+    {
+        CAPTURE(e.first);
+        sensor->get_option(RS2_OPTION_MAX_DOWNSCALE).set(static_cast<float>(e.first));
+        sensor->open(request);
+        REQUIRE(camera->committed().width == e.second);
+        sensor->close();
+    }
+
+    // The fused 1080p unpack delivers the requested resolution
+    std::atomic<int> width{ 0 }, height{ 0 };
+    auto on_frame = [&](frame_interface* f)
+    {
+        frame_holder holder(f);
+        auto video = dynamic_cast<video_frame*>(f);
+        width = video->get_width();
+        height = video->get_height();
+    };
+    sensor->open(request);
+    sensor->start(frame_callback_ptr(new internal_frame_callback<decltype(on_frame)>(on_frame),
+        [](rs2_frame_callback* p) { p->release(); }));
+    for (auto i = 0; i < 100 && !width; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    sensor->stop();
+    sensor->close();
+
+    REQUIRE(width == 640);
+    REQUIRE(height == 360);
+}
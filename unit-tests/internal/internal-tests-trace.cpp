@@ -0,0 +1,76 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#include "../catch/catch.hpp"
+
+#include "trace.h"
+#include "types.h"
+
+#include <map>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+using namespace librealsense;
+
+namespace
+{
+    // Every field of a recorded event is derived from its frame number, so a torn event shows as a mismatch
+    rs2_stream stream_of(unsigned long long frame_number) { return static_cast<rs2_stream>(1 + frame_number % (RS2_STREAM_COUNT - 1)); }
+    int index_of(unsigned long long frame_number) { return static_cast<int>(frame_number % 7); }
+}
+
+TEST_CASE("Dumping the trace while threads record into it", "[trace]")
+{
+    const int recorders = 4;
+    std::atomic<bool> stopping{ false };
+    std::atomic<int> started{ 0 };
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < recorders; t++)
+    {
+        // Fills each ring several times over during the dumps below, so the dump keeps meeting slots being rewritten
+        threads.emplace_back([&stopping, &started]()
+        {
+            for (unsigned long long n = 0; !stopping; n++)
+            {
+                record_trace_event(TRACE_PUBLISH, stream_of(n), index_of(n), n);
+                if (n == 1000) ++started;
+            }
+        });
+    }
+    while (started < recorders)
+        std::this_thread::yield();
+
+    const std::regex event_pattern("\"tid\":([0-9]+),\"s\":\"t\",\"args\":\\{\"stream\":\"([^\"]*)\",\"index\":([0-9]+),\"frame\":([0-9]+)\\}\\}");
+    size_t events = 0;
+    for (auto dump = 0; dump < 50; dump++)
+    {
+        std::stringstream out;
+        dump_trace(out);
+        auto json = out.str();
+        REQUIRE(json.find("{\"traceEvents\":[") == 0);
+        REQUIRE(json.rfind("],\"displayTimeUnit\":\"ms\"}\n") == json.size() - 26);
+
+        // Events of one thread come out in recording order, some may be dropped but none repeated or torn
+        std::map<int, unsigned long long> last_frame;
+        for (std::sregex_iterator it(json.begin(), json.end(), event_pattern), end; it != end; ++it)
+        {
+            auto&& m = *it;
+            auto tid = std::stoi(m[1].str());
+            auto frame_number = std::stoull(m[4].str());
+            CAPTURE(m.str());
+            REQUIRE(m[2].str() == get_string(stream_of(frame_number)));
+            REQUIRE(std::stoi(m[3].str()) == index_of(frame_number));
+
+            auto last = last_frame.find(tid);
+            if (last != last_frame.end())
+                REQUIRE(frame_number > last->second);
+            last_frame[tid] = frame_number;
+            ++events;
+        }
+    }
+
+    stopping = true;
+    for (auto&& t : threads) t.join();
+    REQUIRE(events > 0);
+}
@@ -0,0 +1,246 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// These tests replace the global operator new to count allocations, so they build on their own //
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "unit-tests-common.h"
+#include <algorithm>
+
+using namespace rs2;
+
+// Counts the allocations made on each thread, so that a test can tell how many the frame path of the library makes
+static thread_local size_t allocations_on_this_thread = 0;
+
+void* operator new(std::size_t size)
+{
+    ++allocations_on_this_thread;
+    if (auto ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+// One allocation count of the thread that delivered a frame, taken as the frame arrived
+typedef std::pair<std::thread::id, size_t> allocation_sample;
+
+// Allocations between consecutive frames delivered on the same thread, skipping the frames that fill the frame pools
+static std::vector<size_t> allocations_per_frame(const std::vector<allocation_sample>& samples, size_t warm_up = 10)
+{
+    std::vector<size_t> deltas;
+    for (auto i = warm_up + 1; i < samples.size(); i++)
+    {
+        if (samples[i].first == samples[i - 1].first)
+            deltas.push_back(samples[i].second - samples[i - 1].second);
+    }
+    return deltas;
+}
+
+static size_t median(std::vector<size_t> values)
+{
+    REQUIRE(!values.empty());
+    std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+    return values[values.size() / 2];
+}
+
+// Streams the profile on the sensor and samples the allocations of the delivering thread at each of the first frames
+static std::vector<allocation_sample> sample_allocations(sensor& subdevice, const stream_profile& profile, size_t frames = 60)
+{
+    std::vector<allocation_sample> samples;
+    samples.reserve(frames);
+    std::mutex m;
+    std::condition_variable cv;
+
+    REQUIRE_NOTHROW(subdevice.open(profile));
+    REQUIRE_NOTHROW(subdevice.start([&](rs2::frame f)
+    {
+        std::lock_guard<std::mutex> lock(m);
+        if (samples.size() < frames)
+            samples.push_back({ std::this_thread::get_id(), allocations_on_this_thread });
+        if (samples.size() == frames)
+            cv.notify_one();
+    }));
+
+    {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait_for(lock, std::chrono::seconds(10), [&] { return samples.size() == frames; });
+    }
+    REQUIRE_NOTHROW(subdevice.stop());
+    REQUIRE_NOTHROW(subdevice.close());
+
+    std::lock_guard<std::mutex> lock(m);
+    REQUIRE(samples.size() == frames);
+    return samples;
+}
+
+// Sets the log level for the scope, then goes back to the debug level make_context sets
+class log_level_scope
+{
+public:
+    explicit log_level_scope(rs2_log_severity severity) { rs2::log_to_file(severity); }
+    ~log_level_scope() { rs2::log_to_file(RS2_LOG_SEVERITY_DEBUG); }
+};
+
+// The record and playback backends copy every frame, so only a real backend is held to the bounds
+static bool is_mock_backend()
+{
+    auto argc = command_line_params::instance().get_argc();
+    auto argv = command_line_params::instance().get_argv();
+    for (auto i = 0; i < argc; i++)
+        if (std::string(argv[i]) == "into" || std::string(argv[i]) == "from")
+            return true;
+    return false;
+}
+
+TEST_CASE("Frame callbacks do not allocate per frame", "[live]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        // make_context logs at debug level, which formats a message for every frame
+        log_level_scope quiet(RS2_LOG_SEVERITY_NONE);
+
+        for (auto&& dev : ctx.query_devices())
+        {
+            for (auto&& subdevice : dev.query_sensors())
+            {
+                auto profiles = subdevice.get_stream_profiles();
+                auto profile = std::find_if(profiles.begin(), profiles.end(), [](const stream_profile& p)
+                {
+                    return p.is<video_stream_profile>() && p.fps() >= 30;
+                });
+                if (profile == profiles.end()) continue;
+
+                CAPTURE(profile->stream_name());
+                CAPTURE(profile->format());
+                auto per_frame = allocations_per_frame(sample_allocations(subdevice, *profile));
+
+                // Only the backend's wrapper of the buffer release is expected to allocate on a typical frame
+                auto typical = median(per_frame);
+                CAPTURE(typical);
+                if (!is_mock_backend())
+                    REQUIRE(typical <= 2);
+            }
+        }
+    }
+}
+
+TEST_CASE("Recording does not allocate per frame", "[live]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        log_level_scope quiet(RS2_LOG_SEVERITY_NONE);
+
+        auto list = ctx.query_devices();
+        REQUIRE(list.size() > 0);
+
+        const std::string filename = get_folder_path(special_folder::temp_folder) + "record_allocations.bag";
+        {
+            rs2::recorder recorder(filename, list[0]);
+            for (auto&& subdevice : recorder.query_sensors())
+            {
+                auto profiles = subdevice.get_stream_profiles();
+                auto profile = std::find_if(profiles.begin(), profiles.end(), [](const stream_profile& p)
+                {
+                    return p.is<video_stream_profile>() && p.fps() >= 30;
+                });
+                if (profile == profiles.end()) continue;
+
+                // Recording hands every frame to the write thread, the warm up also skips the frames that initialize the file
+                CAPTURE(profile->stream_name());
+                CAPTURE(profile->format());
+                auto per_frame = allocations_per_frame(sample_allocations(subdevice, *profile));
+
+                // Queueing the write task owns the frame inline, so a recorded frame is held to the bound of a live one
+                auto typical = median(per_frame);
+                CAPTURE(typical);
+                if (!is_mock_backend())
+                    REQUIRE(typical <= 2);
+                break;
+            }
+        }
+        std::remove(filename.c_str());
+    }
+}
+
+TEST_CASE("Syncer does not allocate per frameset for its logging", "[live][software-device]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const int W = 640;
+        const int H = 480;
+        const int BPP = 2;
+
+        std::shared_ptr<software_device> dev = std::make_shared<software_device>();
+        auto s = dev->add_sensor("software_sensor");
+
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE ,{ 0,0,0,0,0 } };
+        s.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, intrinsics });
+        s.add_video_stream({ RS2_STREAM_INFRARED, 1, 1, W, H, 60, BPP, RS2_FORMAT_Y8, intrinsics });
+        dev->create_matcher(RS2_MATCHER_DI);
+
+        auto profiles = s.get_stream_profiles();
+        auto depth = profiles[0];
+        auto ir = profiles[1];
+
+        syncer sync;
+        s.start(sync);
+
+        std::vector<uint8_t> pixels(W * H * BPP, 0);
+        int frame_number = 0;
+
+        auto send_frames = [&]()
+        {
+            frame_number++;
+            auto timestamp = frame_number * 1000.0 / 60;
+            s.on_video_frame({ pixels.data(), [](void*) {}, 0, 0, timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number, depth });
+            s.on_video_frame({ pixels.data(), [](void*) {}, 0, 0, timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number, ir });
+        };
+
+        // Until both streams have arrived once, the syncer lets each frame through on its own
+        send_frames();
+        frameset first;
+        REQUIRE(sync.poll_for_frames(&first));
+
+        // The software sensor syncs on the thread handing it the frames, sample its allocations at every frameset
+        auto allocations_per_frameset = [&](size_t framesets)
+        {
+            std::vector<allocation_sample> samples;
+            samples.reserve(framesets);
+            for (size_t i = 0; i < framesets; i++)
+            {
+                send_frames();
+
+                frameset fs;
+                REQUIRE(sync.poll_for_frames(&fs));
+                REQUIRE(fs.size() == 2);
+                samples.push_back({ std::this_thread::get_id(), allocations_on_this_thread });
+            }
+            return median(allocations_per_frame(samples));
+        };
+
+        // make_context logs at debug level, where every frame and match is formatted
+        auto logged = allocations_per_frameset(60);
+
+        size_t not_logged, filtered;
+        {
+            log_level_scope quiet(RS2_LOG_SEVERITY_NONE);
+            not_logged = allocations_per_frameset(60);
+        }
+        {
+            // Messages below the level are not formatted at all, so they cost no allocation
+            log_level_scope errors_only(RS2_LOG_SEVERITY_ERROR);
+            filtered = allocations_per_frameset(60);
+        }
+
+        CAPTURE(logged);
+        CAPTURE(not_logged);
+        CAPTURE(filtered);
+        REQUIRE(filtered == not_logged);
+        REQUIRE(not_logged < logged);
+    }
+}
@@ -46,6 +46,8 @@ inline std::string space_to_underscore(const std::string& text) {
     return temp;
 }
 
+# define SECTION_FROM_TEST_NAME space_to_underscore(Catch::getCurrentContext().getResultCapture()->getCurrentTestName()).c_str()
+
 class command_line_params
 {
 public:
@@ -16,8 +16,6 @@
 
 using namespace rs2;
 
-# define SECTION_FROM_TEST_NAME space_to_underscore(Catch::getCurrentContext().getResultCapture()->getCurrentTestName()).c_str()
-
 long long current_time()
 {
     return (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() % 10000);
@@ -3519,6 +3517,18 @@ TEST_CASE("Per-frame metadata sanity check", "[live][!mayfail]") {
                             }
                         }
 
+                        // The bulk query must agree with the per-attribute one
+                        rs2_metadata_type md_values[RS2_FRAME_METADATA_COUNT];
+                        int md_supported[RS2_FRAME_METADATA_COUNT];
+                        REQUIRE_NOTHROW(f.get_frame_metadata_all(md_values, md_supported));
+                        for (auto i = 0; i < rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT; i++)
+                        {
+                            CAPTURE(i);
+                            REQUIRE((md_supported[i] != 0) == data.frame_md.md_attributes[i].first);
+                            if (md_supported[i])
+                                REQUIRE(md_values[i] == data.frame_md.md_attributes[i].second);
+                        }
+
 
                         std::unique_lock<std::mutex> lock(m);
                         frames_additional_data.push_back(data);
@@ -3542,6 +3552,13 @@ TEST_CASE("Per-frame metadata sanity check", "[live][!mayfail]") {
                 auto end = internal::get_time();
                 lock.unlock();
 
+                // Every frame seen by the callback was allocated, published and released by now
+                rs2_frame_stats stats;
+                REQUIRE_NOTHROW(stats = subdevice.get_frame_stats());
+                REQUIRE(stats.allocations >= frames_additional_data.size());
+                REQUIRE(stats.peak_in_flight > 0);
+                REQUIRE(stats.in_flight == 0);
+
                 auto seconds = (end - start)*msec_to_sec;
 
                 CAPTURE(start);
@@ -4091,7 +4108,7 @@ TEST_CASE("Syncer sanity with software-device device", "[live][software-device]"
         auto depth = profiles[0];
         auto ir = profiles[1];
 
-        syncer sync;
+        syncer sync(10);
         s.start(sync);
        
         std::vector<uint8_t> pixels(W * H * BPP, 0);
@@ -4261,6 +4278,272 @@ TEST_CASE("Syncer clean_inactive_streams by frame number with software-device de
     }
 }
 
+TEST_CASE("Frame allocator API with software-device device", "[live][software-device]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        struct releasing_allocator : rs2_frame_allocator
+        {
+            bool* released;
+            explicit releasing_allocator(bool* released) : released(released) {}
+            void* allocate(size_t size) override { return malloc(size); }
+            void deallocate(void* buffer, size_t size) override { free(buffer); }
+            void release() override { *released = true; delete this; }
+        };
+
+        const int W = 640;
+        const int H = 480;
+        const int BPP = 2;
+        bool released = false;
+        {
+            software_device dev;
+            auto s = dev.add_sensor("software_sensor");
+            rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE ,{ 0,0,0,0,0 } };
+            auto depth = s.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, intrinsics });
+            auto sensor = s.get().get();
+
+            auto allocate = [](size_t size, void* user) -> void* { return malloc(size); };
+            auto deallocate = [](void* buffer, size_t size, void* user) { free(buffer); };
+
+            // Both functions are required
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator(sensor, nullptr, deallocate, nullptr, &e);
+            REQUIRE(e != nullptr);
+            rs2_free_error(e);
+            e = nullptr;
+            rs2_set_frame_allocator(sensor, allocate, nullptr, nullptr, &e);
+            REQUIRE(e != nullptr);
+            rs2_free_error(e);
+            e = nullptr;
+            rs2_set_frame_allocator_cpp(sensor, nullptr, &e);
+            REQUIRE(e != nullptr);
+            rs2_free_error(e);
+            e = nullptr;
+
+            rs2_set_frame_allocator(sensor, allocate, deallocate, nullptr, &e);
+            REQUIRE(e == nullptr);
+
+            // The sensor takes the allocator object of the c++ API, and releases it once nothing uses it any more
+            rs2_set_frame_allocator_cpp(sensor, new releasing_allocator(&released), &e);
+            REQUIRE(e == nullptr);
+
+            frame_queue q;
+            s.start(q);
+            std::vector<uint8_t> pixels(W * H * BPP, 0);
+            s.on_video_frame({ pixels.data(), [](void*) {}, 0, 0, 0, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 1, depth });
+            frame f;
+            REQUIRE(q.poll_for_frame(&f));
+            REQUIRE(f.get_frame_number() == 1);
+            f = frame();
+            s.stop();
+            REQUIRE_FALSE(released);
+        }
+        REQUIRE(released);
+    }
+}
+
+TEST_CASE("Bulk frame metadata query with software-device device", "[live][software-device]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const int W = 640;
+        const int H = 480;
+        const int BPP = 2;
+        software_device dev;
+        auto s = dev.add_sensor("software_sensor");
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE ,{ 0,0,0,0,0 } };
+        auto depth = s.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, intrinsics });
+
+        frame_queue q;
+        s.start(q);
+        std::vector<uint8_t> pixels(W * H * BPP, 0);
+        s.on_video_frame({ pixels.data(), [](void*) {}, 0, 0, 0, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 1, depth });
+        frame f;
+        REQUIRE(q.poll_for_frame(&f));
+
+        // Every entry is written, and agrees with the per-attribute query
+        const int extra = 4;
+        std::vector<rs2_metadata_type> values(RS2_FRAME_METADATA_COUNT + extra, 0x55);
+        std::vector<int> supported(RS2_FRAME_METADATA_COUNT + extra, 0x55);
+        int found = -1;
+        REQUIRE_NOTHROW(found = f.get_frame_metadata_all(values.data(), supported.data()));
+        int expected = 0;
+        for (auto i = 0; i < RS2_FRAME_METADATA_COUNT; i++)
+        {
+            CAPTURE(i);
+            auto md = static_cast<rs2_frame_metadata_value>(i);
+            REQUIRE((supported[i] != 0) == f.supports_frame_metadata(md));
+            if (supported[i])
+            {
+                REQUIRE(values[i] == f.get_frame_metadata(md));
+                expected++;
+            }
+            else
+                REQUIRE(values[i] == 0);
+        }
+        REQUIRE(found == expected);
+
+        // Nothing is written past the caller's count
+        REQUIRE(f.get_frame_metadata_all(values.data(), supported.data(), 0) == 0);
+        std::fill(values.begin(), values.end(), 0x55);
+        std::fill(supported.begin(), supported.end(), 0x55);
+        REQUIRE_NOTHROW(f.get_frame_metadata_all(values.data(), supported.data(), 2));
+        for (auto i = 2; i < RS2_FRAME_METADATA_COUNT + extra; i++)
+        {
+            CAPTURE(i);
+            REQUIRE(values[i] == 0x55);
+            REQUIRE(supported[i] == 0x55);
+        }
+
+        // Attributes this library does not know of are reported as unsupported
+        REQUIRE_NOTHROW(f.get_frame_metadata_all(values.data(), supported.data(), RS2_FRAME_METADATA_COUNT + extra));
+        for (int i = RS2_FRAME_METADATA_COUNT; i < RS2_FRAME_METADATA_COUNT + extra; i++)
+        {
+            CAPTURE(i);
+            REQUIRE(values[i] == 0);
+            REQUIRE(supported[i] == 0);
+        }
+
+        REQUIRE_NOTHROW(f.get_frame_metadata_all(nullptr, nullptr, 0));
+        REQUIRE_THROWS(f.get_frame_metadata_all(nullptr, supported.data(), 1));
+        REQUIRE_THROWS(f.get_frame_metadata_all(values.data(), nullptr, 1));
+        REQUIRE_THROWS(f.get_frame_metadata_all(values.data(), supported.data(), -1));
+
+        f = frame();
+        s.stop();
+    }
+}
+
+TEST_CASE("Frame statistics with software-device device", "[live][software-device]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const int W = 640;
+        const int H = 480;
+        const int BPP = 2;
+        software_device dev;
+        auto s = dev.add_sensor("software_sensor");
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE ,{ 0,0,0,0,0 } };
+        auto depth = s.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, intrinsics });
+        std::vector<uint8_t> pixels(W * H * BPP, 0);
+
+        rs2_frame_stats stats;
+        REQUIRE_NOTHROW(stats = s.get_frame_stats());
+        REQUIRE(stats.allocations == 0);
+        REQUIRE(stats.in_flight == 0);
+
+        // Hold on to every frame, so that the third one finds the archive full
+        s.set_option(RS2_OPTION_FRAMES_QUEUE_SIZE, 2);
+        frame_queue q(10);
+        s.start(q);
+        for (auto i = 1; i <= 3; i++)
+            s.on_video_frame({ pixels.data(), [](void*) {}, 0, 0, 0, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth });
+
+        REQUIRE_NOTHROW(stats = s.get_frame_stats());
+        REQUIRE(stats.allocations == 3);
+        REQUIRE(stats.drops == 1);
+        REQUIRE(stats.in_flight == 2);
+        REQUIRE(stats.peak_in_flight == 2);
+        // Software frames wrap the caller's pixels, so no buffer is allocated nor recycled
+        REQUIRE(stats.bytes_allocated == 0);
+        REQUIRE(stats.buffer_reuses == 0);
+
+        frame f;
+        REQUIRE(q.poll_for_frame(&f));
+        REQUIRE(f.get_frame_number() == 1);
+        REQUIRE(q.poll_for_frame(&f));
+        REQUIRE(f.get_frame_number() == 2);
+        REQUIRE_FALSE(q.poll_for_frame(&f));
+        f = frame();
+
+        REQUIRE_NOTHROW(stats = s.get_frame_stats());
+        REQUIRE(stats.in_flight == 0);
+        REQUIRE(stats.mean_hold_time >= 0);
+        s.stop();
+
+        // The counters belong to the sensor and carry over to the next session
+        s.start(q);
+        s.on_video_frame({ pixels.data(), [](void*) {}, 0, 0, 0, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 4, depth });
+        REQUIRE(q.poll_for_frame(&f));
+        f = frame();
+        s.stop();
+
+        REQUIRE_NOTHROW(stats = s.get_frame_stats());
+        REQUIRE(stats.allocations == 4);
+        REQUIRE(stats.drops == 1);
+        REQUIRE(stats.in_flight == 0);
+        REQUIRE(stats.peak_in_flight == 2);
+    }
+}
+
+TEST_CASE("Latency statistics with software-device device", "[live][software-device]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const int W = 64;
+        const int H = 48;
+        const int BPP = 2;
+        software_device dev;
+        auto s = dev.add_sensor("software_sensor");
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE ,{ 0,0,0,0,0 } };
+        auto depth = s.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, intrinsics });
+        auto ir = s.add_video_stream({ RS2_STREAM_INFRARED, 1, 1, W, H, 60, 1, RS2_FORMAT_Y8, intrinsics });
+        std::vector<uint8_t> pixels(W * H * BPP, 0);
+
+        // Nothing was published yet
+        rs2_latency_stats latency;
+        REQUIRE_NOTHROW(latency = s.get_latency_stats(RS2_STREAM_DEPTH, 0, RS2_LATENCY_CALLBACK_DURATION));
+        REQUIRE(latency.count == 0);
+
+        // Every depth frame keeps the callback busy for a couple of milliseconds
+        std::atomic<int> delivered{ 0 };
+        s.start([&](frame f)
+        {
+            if (f.get_profile().stream_type() == RS2_STREAM_DEPTH)
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            ++delivered;
+        });
+        const int frames = 20;
+        for (auto i = 1; i <= frames; i++)
+        {
+            s.on_video_frame({ pixels.data(), [](void*) {}, W * BPP, BPP, i * 16., RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth });
+            s.on_video_frame({ pixels.data(), [](void*) {}, W, 1, i * 16., RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, ir });
+        }
+        for (auto i = 0; i < 100 && delivered < 2 * frames; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        s.stop();
+        REQUIRE(delivered == 2 * frames);
+
+        // Each stream has its own histograms, holding one sample per frame, with ordered percentiles
+        for (auto type : { RS2_LATENCY_SENSOR_TO_ARRIVAL, RS2_LATENCY_ARRIVAL_TO_CALLBACK, RS2_LATENCY_CALLBACK_DURATION })
+        {
+            CAPTURE(type);
+            for (auto stream : { RS2_STREAM_DEPTH, RS2_STREAM_INFRARED })
+            {
+                CAPTURE(stream);
+                REQUIRE_NOTHROW(latency = s.get_latency_stats(stream, stream == RS2_STREAM_DEPTH ? 0 : 1, type));
+                REQUIRE(latency.count == frames);
+                REQUIRE(latency.min <= latency.p50);
+                REQUIRE(latency.p50 <= latency.p90);
+                REQUIRE(latency.p90 <= latency.p99);
+                REQUIRE(latency.p99 <= latency.max);
+            }
+        }
+
+        REQUIRE_NOTHROW(latency = s.get_latency_stats(RS2_STREAM_DEPTH, 0, RS2_LATENCY_CALLBACK_DURATION));
+        REQUIRE(latency.min >= 1.9);
+        REQUIRE_NOTHROW(latency = s.get_latency_stats(RS2_STREAM_INFRARED, 1, RS2_LATENCY_CALLBACK_DURATION));
+        REQUIRE(latency.p50 < 1.9);
+
+        // A stream the sensor never published has no statistics, and a reset clears all of them
+        REQUIRE_NOTHROW(latency = s.get_latency_stats(RS2_STREAM_COLOR, 0, RS2_LATENCY_CALLBACK_DURATION));
+        REQUIRE(latency.count == 0);
+        REQUIRE_NOTHROW(s.reset_latency_stats());
+        REQUIRE_NOTHROW(latency = s.get_latency_stats(RS2_STREAM_DEPTH, 0, RS2_LATENCY_CALLBACK_DURATION));
+        REQUIRE(latency.count == 0);
+    }
+}
+
 #define ADD_ENUM_TEST_CASE(rs2_enum_type, RS2_ENUM_COUNT)                                  \
 TEST_CASE(#rs2_enum_type " enum test", "[live]") {                                         \
     int last_item_index = static_cast<int>(RS2_ENUM_COUNT);                                \
@@ -1851,6 +1851,8 @@ class Frame {
       case constants.format.FORMAT_MOTION_RAW:
       case constants.format.FORMAT_GPIO_RAW:
       case constants.format.FORMAT_RAW10:
+      case constants.format.FORMAT_NV12:
+      case constants.format.FORMAT_I420:
       case constants.format.FORMAT_ANY:
         this.typedArray = new Uint8Array(this.arrayBuffer);
         return this.typedArray;
@@ -3650,6 +3652,18 @@ const format = {
    * <br>Equivalent to its uppercase counterpart.
    */
   format_disparity32: 'disparity32',
+  /**
+   * String literal of <code>'nv12'</code>. <br>8-bit luminance plane followed by a half-resolution
+   * plane of interleaved 8-bit U and V samples (YUV 4:2:0).
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  format_nv12: 'nv12',
+  /**
+   * String literal of <code>'i420'</code>. <br>8-bit luminance plane followed by half-resolution
+   * 8-bit U and V planes (YUV 4:2:0).
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  format_i420: 'i420',
   /**
    * When passed to enable stream, librealsense will try to provide best suited
    * format. <br>Equivalent to its lowercase counterpart.
@@ -3764,6 +3778,18 @@ const format = {
    * @type {Integer}
    */
   FORMAT_DISPARITY32: RS2.RS2_FORMAT_DISPARITY32,
+  /**
+   * 8-bit luminance plane followed by a half-resolution plane of interleaved 8-bit U and V
+   * samples (YUV 4:2:0). <br>Equivalent to its lowercase counterpart.
+   * @type {Integer}
+   */
+  FORMAT_NV12: RS2.RS2_FORMAT_NV12,
+  /**
+   * 8-bit luminance plane followed by half-resolution 8-bit U and V planes (YUV 4:2:0).
+   * <br>Equivalent to its lowercase counterpart.
+   * @type {Integer}
+   */
+  FORMAT_I420: RS2.RS2_FORMAT_I420,
   /**
    * Number of enumeration values. Not a valid input: intended to be used in for-loops.
    * <br>Equivalent to its lowercase counterpart.
@@ -3821,6 +3847,10 @@ const format = {
         return this.format_6dof;
       case this.FORMAT_DISPARITY32:
         return this.format_disparity32;
+      case this.FORMAT_NV12:
+        return this.format_nv12;
+      case this.FORMAT_I420:
+        return this.format_i420;
     }
   },
 };
@@ -4244,6 +4274,41 @@ const option = {
    * <br>Equivalent to its uppercase counterpart.
    */
   option_stereo_baseline: 'stereo-baseline',
+  /**
+   * String literal of <code>'zero-copy'</code>. <br>Hand out pass-through frames in the capture buffers instead of copying them
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_zero_copy: 'zero-copy',
+  /**
+   * String literal of <code>'capture-buffers'</code>. <br>Number of buffers the backend captures frames into
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_capture_buffers: 'capture-buffers',
+  /**
+   * String literal of <code>'capture-memory'</code>. <br>Type of memory the backend captures frames into
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_capture_memory: 'capture-memory',
+  /**
+   * String literal of <code>'Parallel Unpack'</code>. <br>Unpack large frames in row bands on a thread pool shared by all sensors
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_parallel_unpack: 'Parallel Unpack',
+  /**
+   * String literal of <code>'Unpack Queue Size'</code>. <br>Frames queued between capture and unpacking on a dedicated thread, 0 to unpack on the capture thread
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_unpack_queue_size: 'Unpack Queue Size',
+  /**
+   * String literal of <code>'Unpack Queue Policy'</code>. <br>What happens to a frame that arrives while the unpack queue is full
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_unpack_queue_policy: 'Unpack Queue Policy',
+  /**
+   * String literal of <code>'Max Downscale'</code>. <br>Largest factor a resolution the sensor also captures natively may be downscaled by from a larger capture, 1 to capture it natively
+   * <br>Equivalent to its uppercase counterpart.
+   */
+  option_max_downscale: 'Max Downscale',
   /**
    * Enable / disable color backlight compensatio.<br>Equivalent to its lowercase counterpart.
    * @type {Integer}
@@ -4476,6 +4541,48 @@ const option = {
    * @type {Integer}
    */
   OPTION_HOLES_FILL: RS2.RS2_OPTION_HOLES_FILL,
+  /**
+   * Hand out pass-through frames in the capture buffers instead of copying them
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_ZERO_COPY: RS2.RS2_OPTION_ZERO_COPY,
+  /**
+   * Number of buffers the backend captures frames into
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_CAPTURE_BUFFERS: RS2.RS2_OPTION_CAPTURE_BUFFERS,
+  /**
+   * Type of memory the backend captures frames into
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_CAPTURE_MEMORY: RS2.RS2_OPTION_CAPTURE_MEMORY,
+  /**
+   * Unpack large frames in row bands on a thread pool shared by all sensors
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_PARALLEL_UNPACK: RS2.RS2_OPTION_PARALLEL_UNPACK,
+  /**
+   * Frames queued between capture and unpacking on a dedicated thread, 0 to unpack on the capture thread
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_UNPACK_QUEUE_SIZE: RS2.RS2_OPTION_UNPACK_QUEUE_SIZE,
+  /**
+   * What happens to a frame that arrives while the unpack queue is full
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_UNPACK_QUEUE_POLICY: RS2.RS2_OPTION_UNPACK_QUEUE_POLICY,
+  /**
+   * Largest factor a resolution the sensor also captures natively may be downscaled by from a larger capture, 1 to capture it natively
+   * <br>Equivalent to its lowercase counterpart
+   * @type {Integer}
+   */
+  OPTION_MAX_DOWNSCALE: RS2.RS2_OPTION_MAX_DOWNSCALE,
   /**
    * Number of enumeration values. Not a valid input: intended to be used in for-loops.
    * @type {Integer}
@@ -4574,6 +4681,20 @@ const option = {
         return this.option_holes_fill;
       case this.OPTION_STEREO_BASELINE:
         return this.option_stereo_baseline;
+      case this.OPTION_ZERO_COPY:
+        return this.option_zero_copy;
+      case this.OPTION_CAPTURE_BUFFERS:
+        return this.option_capture_buffers;
+      case this.OPTION_CAPTURE_MEMORY:
+        return this.option_capture_memory;
+      case this.OPTION_PARALLEL_UNPACK:
+        return this.option_parallel_unpack;
+      case this.OPTION_UNPACK_QUEUE_SIZE:
+        return this.option_unpack_queue_size;
+      case this.OPTION_UNPACK_QUEUE_POLICY:
+        return this.option_unpack_queue_policy;
+      case this.OPTION_MAX_DOWNSCALE:
+        return this.option_max_downscale;
       default:
         throw new TypeError(
             'option.optionToString(option) expects a valid value as the 1st argument');
@@ -4167,6 +4167,8 @@ void InitModule(v8::Local<v8::Object> exports) {
   _FORCE_SET_ENUM(RS2_FORMAT_GPIO_RAW);
   _FORCE_SET_ENUM(RS2_FORMAT_6DOF);
   _FORCE_SET_ENUM(RS2_FORMAT_DISPARITY32);
+  _FORCE_SET_ENUM(RS2_FORMAT_NV12);
+  _FORCE_SET_ENUM(RS2_FORMAT_I420);
   _FORCE_SET_ENUM(RS2_FORMAT_COUNT);
 
   // rs2_frame_type_value
@@ -4231,6 +4233,13 @@ void InitModule(v8::Local<v8::Object> exports) {
   _FORCE_SET_ENUM(RS2_OPTION_FILTER_SMOOTH_DELTA);
   _FORCE_SET_ENUM(RS2_OPTION_HOLES_FILL);
   _FORCE_SET_ENUM(RS2_OPTION_STEREO_BASELINE);
+  _FORCE_SET_ENUM(RS2_OPTION_ZERO_COPY);
+  _FORCE_SET_ENUM(RS2_OPTION_CAPTURE_BUFFERS);
+  _FORCE_SET_ENUM(RS2_OPTION_CAPTURE_MEMORY);
+  _FORCE_SET_ENUM(RS2_OPTION_PARALLEL_UNPACK);
+  _FORCE_SET_ENUM(RS2_OPTION_UNPACK_QUEUE_SIZE);
+  _FORCE_SET_ENUM(RS2_OPTION_UNPACK_QUEUE_POLICY);
+  _FORCE_SET_ENUM(RS2_OPTION_MAX_DOWNSCALE);
   _FORCE_SET_ENUM(RS2_OPTION_COUNT);
 
   // rs2_camera_info
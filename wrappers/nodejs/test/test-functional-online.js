@@ -158,6 +158,8 @@ describe('enum value test', function() {
       'FORMAT_GPIO_RAW',
       'FORMAT_6DOF',
       'FORMAT_DISPARITY32',
+      'FORMAT_NV12',
+      'FORMAT_I420',
       'FORMAT_COUNT',
     ];
     const strAttrs = [
@@ -181,6 +183,8 @@ describe('enum value test', function() {
       'format_gpio_raw',
       'format_6dof',
       'format_disparity32',
+      'format_nv12',
+      'format_i420',
     ];
     numberAttrs.forEach((attr) => {
       assert.equal(typeof obj[attr], 'number');
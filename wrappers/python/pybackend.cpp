@@ -125,6 +125,13 @@ PYBIND11_MODULE(NAME, m) {
         .value("filter_smooth_delta", RS2_OPTION_FILTER_SMOOTH_DELTA)
         .value("filter_holes_fill", RS2_OPTION_HOLES_FILL)
         .value("stereo_baseline", RS2_OPTION_STEREO_BASELINE)
+        .value("zero_copy", RS2_OPTION_ZERO_COPY)
+        .value("capture_buffers", RS2_OPTION_CAPTURE_BUFFERS)
+        .value("capture_memory", RS2_OPTION_CAPTURE_MEMORY)
+        .value("parallel_unpack", RS2_OPTION_PARALLEL_UNPACK)
+        .value("unpack_queue_size", RS2_OPTION_UNPACK_QUEUE_SIZE)
+        .value("unpack_queue_policy", RS2_OPTION_UNPACK_QUEUE_POLICY)
+        .value("max_downscale", RS2_OPTION_MAX_DOWNSCALE)
         .value("count", RS2_OPTION_COUNT);
 
     py::enum_<platform::power_state> power_state(m, "power_state");
@@ -248,7 +255,7 @@ PYBIND11_MODULE(NAME, m) {
         {
             callback(p, fo);
             next();
-        }, 4);
+        }, 4, platform::CAPTURE_MEMORY_AUTO);
             }
             , "profile"_a, "callback"_a)
         .def("stream_on", [](platform::retry_controls_work_around& dev) {
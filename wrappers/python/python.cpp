@@ -317,6 +317,11 @@ PYBIND11_MODULE(NAME, m) {
                 { static_cast<size_t>(vf.get_height()), static_cast<size_t>(vf.get_width()), 4 },
                 { static_cast<size_t>(vf.get_stride_in_bytes()), static_cast<size_t>(vf.get_bytes_per_pixel()), 1 });
                 break;
+            case RS2_FORMAT_NV12: case RS2_FORMAT_I420: // The chroma planes follow the luminance plane, as rows of the same stride
+                return BufData(const_cast<void*>(vf.get_data()), 1, bytes_per_pixel_to_format[1], 2,
+                { static_cast<size_t>(vf.get_height() * 3 / 2), static_cast<size_t>(vf.get_width()) },
+                { static_cast<size_t>(vf.get_stride_in_bytes()), 1 });
+                break;
             default:
                 return BufData(const_cast<void*>(vf.get_data()), static_cast<size_t>(vf.get_bytes_per_pixel()), bytes_per_pixel_to_format[vf.get_bytes_per_pixel()], 2,
                 { static_cast<size_t>(vf.get_height()), static_cast<size_t>(vf.get_width()) },
@@ -934,6 +939,9 @@ PYBIND11_MODULE(NAME, m) {
     /* rs2.hpp */
     m.def("log_to_console", &rs2::log_to_console, "min_severity"_a);
     m.def("log_to_file", &rs2::log_to_file, "min_severity"_a, "file_path"_a);
+    m.def("enable_frame_trace", &rs2::enable_frame_trace, "enable"_a = true);
+    m.def("dump_frame_trace", &rs2::dump_frame_trace, "file_path"_a);
+    m.def("configure_executor", &rs2::configure_executor, "threads"_a, "affinity_mask"_a = 0);
 
     /* rsutil.h */
     m.def("rs2_project_point_to_pixel", [](const rs2_intrinsics& intrin, const std::array<float, 3>& point)->std::array<float, 2>